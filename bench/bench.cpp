@@ -0,0 +1,409 @@
+// Copyright (c) 2022 Trevor Makes
+
+// Host benchmark for the idle modes: records the DAC write stream and reports
+// the cost of each mode per frame. Build and run with `pio run -e native -t exec`
+// or pass a frame count to the program to override the default. With --pty,
+// runs streaming mode on a pseudo-terminal instead (see tools/stream.py).
+
+#include "main.hpp"
+#include "trig.hpp"
+#include "transform.hpp"
+
+#include <chrono>
+#include <fcntl.h>
+#include <stdio.h>
+#include <termios.h>
+#include <unistd.h>
+
+IdleFn g_idle_fn = nullptr;
+
+struct Stats {
+  uint32_t writes;
+  uint32_t redundant;
+  uint32_t travel; // Sum of X and Y steps
+  uint32_t hold_us;
+};
+
+static Stats g_stats;
+static int16_t g_last_x = -1;
+static int16_t g_last_y = -1;
+
+void dac_sink_x(uint8_t x) {
+  ++g_stats.writes;
+  if (x == g_last_x) ++g_stats.redundant;
+  if (g_last_x >= 0) g_stats.travel += abs(x - g_last_x);
+  g_last_x = x;
+}
+
+void dac_sink_y(uint8_t y) {
+  ++g_stats.writes;
+  if (y == g_last_y) ++g_stats.redundant;
+  if (g_last_y >= 0) g_stats.travel += abs(y - g_last_y);
+  g_last_y = y;
+}
+
+void dac_sink_hold(uint8_t us) {
+  g_stats.hold_us += us;
+}
+
+template <void (*Fn)(Args)>
+IdleFn do_command() {
+  Fn(Args());
+  return g_idle_fn;
+}
+
+// Run a CLI command with the given arguments, discarding its output
+static void run_command(void (*fn)(Args), const char* args) {
+  char line[32];
+  strncpy(line, args, sizeof(line) - 1);
+  line[sizeof(line) - 1] = '\0';
+  g_serial_ex.muted = true;
+  fn(Args(line));
+  g_serial_ex.muted = false;
+}
+
+// Display list scene built from the CLI primitives
+static IdleFn init_dlist() {
+  run_command(dl_command, "clear");
+  run_command(dl_line, "0 0 63 0");
+  run_command(dl_line, "63 0 63 63");
+  run_command(dl_circle, "32 32 20");
+  run_command(dl_arc, "32 32 28 0 128");
+  run_command(dl_poly, "10 50 20 40 30 50 10 50");
+  run_command(dl_curve, "4 12 20 30 40 0 60 12");
+  return g_idle_fn;
+}
+
+// Cubic Bezier evaluated directly at each of `n` points and joined by lines
+static void cubic_lines(int8_t x0, int8_t y0, int8_t x1, int8_t y1,
+    int8_t x2, int8_t y2, int8_t x3, int8_t y3, int32_t n) {
+  int8_t px = x0, py = y0;
+  for (int32_t i = 1; i <= n; ++i) {
+    int32_t u = n - i;
+    int32_t b0 = u * u * u, b1 = 3 * u * u * i, b2 = 3 * u * i * i, b3 = i * i * i;
+    int32_t n3 = n * n * n;
+    int8_t x = (b0 * x0 + b1 * x1 + b2 * x2 + b3 * x3 + n3 / 2) / n3;
+    int8_t y = (b0 * y0 + b1 * y1 + b2 * y2 + b3 * y3 + n3 / 2) / n3;
+    draw_line(px, py, x, y);
+    px = x, py = y;
+  }
+}
+
+// Arc with a vertex every `step` 1/256 turns, each from the sine table
+static void arc_lines(int8_t xm, int8_t ym, int8_t r, uint8_t from, uint8_t sweep, uint8_t step) {
+  int8_t px = xm + ((cos8(from) * r + 128) >> 8);
+  int8_t py = ym + ((sin8(from) * r + 128) >> 8);
+  for (uint16_t a = step; a <= sweep; a += step) {
+    int8_t x = xm + ((cos8(from + a) * r + 128) >> 8);
+    int8_t y = ym + ((sin8(from + a) * r + 128) >> 8);
+    draw_line(px, py, x, y);
+    px = x, py = y;
+  }
+}
+
+// Same scene as curves_idle, with the curves approximated by 32 line segments
+static void curves_lines_idle() {
+  static uint8_t phase = 0;
+  for (uint8_t i = 0; i < 3; ++i) {
+    int8_t y = 20 + i * 12;
+    int8_t a = sin8(phase + i * 32) >> 4;
+    int8_t b = cos8(phase * 2 + i * 48) >> 4;
+    cubic_lines(4, y, 21, y + a, 42, y - b, 59, y, 32);
+  }
+  arc_lines(32, 32, 30, phase, 96, 3);
+  arc_lines(32, 32, 30, phase + 128, 96, 3);
+  phase += 2;
+}
+
+static IdleFn init_curves_lines() {
+  return curves_lines_idle;
+}
+
+// Doge with both grayscale planes holding the same image, so every pixel is
+// drawn at level 3
+static IdleFn init_doge_gray() {
+  init_doge();
+  toggle_gray(Args());
+  extern uint8_t BITMAP_RAM[];
+  memcpy(BITMAP_RAM + 512, BITMAP_RAM, 512);
+  return g_idle_fn;
+}
+
+// Doge with extra hold after jumps, to show what settling costs per frame
+static IdleFn init_doge_settle() {
+  run_command(set_settle, "0 0 1 1 2 3 4");
+  return init_doge();
+}
+
+// Modes at the detail level the frame governor would fall back to when
+// over budget
+template <IdleFn (*Fn)(), uint8_t LEVEL>
+static IdleFn init_detail() {
+  g_detail_level = LEVEL;
+  return Fn();
+}
+
+// A line printed every frame, scrolling the logo up as the print command does
+static void print_idle() {
+  run_command(print_message, "Hello!");
+  bitmap_idle();
+}
+
+static IdleFn init_print() {
+  init_logo();
+  return print_idle;
+}
+
+// Logo traced by the raster scan, as grayscale images are
+static IdleFn init_logo_gray() {
+  init_logo();
+  toggle_gray(Args());
+  return g_idle_fn;
+}
+
+// Lissajous computed on the fly, as when span memory holds a grayscale image
+static IdleFn init_lj_56_uncached() {
+  toggle_gray(Args());
+  return init_lj_56();
+}
+
+struct Mode {
+  const char* name;
+  IdleFn (*init_fn)();
+  uint16_t calls_per_frame; // Idle calls needed to trace the whole figure
+  const char* scan; // Bitmap scan order
+};
+
+static const Mode MODES[] = {
+  { "circle", do_command<do_circle>, 1, "raster" },
+  { "cross", do_command<do_cross>, 1, "raster" },
+  { "bounce", init_bounce, 1, "raster" },
+  { "circum", init_circum, 1, "raster" },
+  { "circum/lod1", init_detail<init_circum, 1>, 1, "raster" },
+  { "spin", init_spin, 1, "raster" },
+  { "cube", init_cube, 1, "raster" },
+  { "ico", init_ico, 1, "raster" },
+  { "ico/lod2", init_detail<init_ico, 2>, 1, "raster" },
+  { "curves", init_curves, 1, "raster" },
+  { "curves/lines", init_curves_lines, 1, "raster" },
+  { "lissajous", init_lj_56, 1, "raster" },
+  { "lj/uncached", init_lj_56_uncached, 1, "raster" },
+  { "bitmap", init_doge, 1, "raster" },
+  { "bitmap/gray", init_doge_gray, 1, "raster" },
+  { "bitmap/settle", init_doge_settle, 1, "raster" },
+  { "bitmap/lod1", init_detail<init_doge, 1>, 1, "raster" },
+  { "logo", init_logo, 1, "raster" },
+  { "logo/gray", init_logo_gray, 1, "raster" },
+  { "vlogo", init_vlogo, 1, "raster" },
+  { "logo/serp", init_logo, 1, "serp" },
+  { "logo/column", init_logo, 1, "column" },
+  { "logo/nearest", init_logo, 1, "nearest" },
+  { "maze", init_maze, 1, "raster" },
+  { "print", init_print, 1, "raster" },
+  { "dlist", init_dlist, 1, "raster" },
+  { "life", init_life, 1, "raster" },
+};
+
+// Select scan order without reporting it
+static void set_scan(const char* order) {
+  run_command(set_scan_order, order);
+}
+
+// Stand in for the board on a pty: wait for the "stream" command line, run
+// streaming mode on it and report what was drawn once the host quits
+static int run_pty() {
+  int master = posix_openpt(O_RDWR | O_NOCTTY);
+  if (master < 0 || grantpt(master) < 0 || unlockpt(master) < 0) {
+    perror("pty");
+    return 1;
+  }
+
+  // Hold the other end open in raw mode so bytes pass through untranslated
+  // and the pty outlives the sender closing it
+  int slave = open(ptsname(master), O_RDWR | O_NOCTTY);
+  termios tio;
+  tcgetattr(slave, &tio);
+  cfmakeraw(&tio);
+  tcsetattr(slave, TCSANOW, &tio);
+  printf("%s\n", ptsname(master));
+  fflush(stdout);
+
+  Serial.fd = master;
+  char line[32];
+  uint8_t len = 0;
+  for (;;) {
+    int c = Serial.read();
+    if (c < 0) {
+      usleep(1000);
+    } else if (c == '\r' || c == '\n') {
+      if (len > 0) break;
+    } else if (len < sizeof(line) - 1) {
+      line[len++] = c;
+    }
+  }
+  line[len] = '\0';
+
+  Args args(line);
+  if (strcmp(args.next(), "stream") != 0) {
+    fprintf(stderr, "expected stream command\n");
+    return 1;
+  }
+  g_stats = Stats{};
+  auto start = std::chrono::steady_clock::now();
+  stream_data(args);
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  printf("%u writes, %u travel in %.2f s\n", g_stats.writes, g_stats.travel,
+    std::chrono::duration<double>(elapsed).count());
+  close(slave);
+  close(master);
+  return 0;
+}
+
+// Trig implementations replaced by trig.hpp, kept for comparison
+namespace old {
+  constexpr uint8_t RESOLUTION = 64;
+  #define SINE_STEP(i) uint8_t((sin(i * M_PI / 8) + 1.f) * 0.5f * (RESOLUTION - 1))
+  static uint8_t const SINE_LUT[16] = {
+    SINE_STEP(0),  SINE_STEP(1),  SINE_STEP(2),  SINE_STEP(3),
+    SINE_STEP(4),  SINE_STEP(5),  SINE_STEP(6),  SINE_STEP(7),
+    SINE_STEP(8),  SINE_STEP(9),  SINE_STEP(10), SINE_STEP(11),
+    SINE_STEP(12), SINE_STEP(13), SINE_STEP(14), SINE_STEP(15),
+  };
+  #undef SINE_STEP
+
+  uint8_t uint_sine(uint8_t x) {
+    uint8_t i_a = (x >> 4) & 15;
+    uint8_t i_b = (i_a + 1) & 15;
+    uint8_t a = SINE_LUT[i_a];
+    uint8_t b = SINE_LUT[i_b];
+    uint8_t t = x & 15;
+    return (a * (16 - t) + b * t) >> 4;
+  }
+
+  // X coordinate of random_point for an angle in degrees
+  uint8_t point_x(uint16_t deg) {
+    float angle = radians(deg);
+    return (cos(angle) + 1) * 0.5 * (RESOLUTION - 1);
+  }
+}
+
+uint8_t uint_sine(uint8_t x);
+
+// X coordinate of random_point for an angle in 8-bit binary radians
+static uint8_t point_x(uint8_t angle) {
+  return (uint16_t(cos8(angle) + 256) * (old::RESOLUTION - 1) + 256) >> 9;
+}
+
+struct Error {
+  double max = 0;
+  double sum_sq = 0;
+  uint32_t count = 0;
+
+  void add(double error) {
+    error = fabs(error);
+    if (error > max) max = error;
+    sum_sq += error * error;
+    ++count;
+  }
+};
+
+static volatile int32_t g_trig_sink;
+
+// Time `calls` calls of fn(i) in host nanoseconds per call
+template <typename Fn>
+static double time_calls(uint32_t calls, Fn fn) {
+  auto start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < calls; ++i) g_trig_sink = fn(i);
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::nano>(elapsed).count() / calls;
+}
+
+static void print_trig(const char* name, const char* unit, const Error& error, double ns) {
+  printf("%-14s %12s %12.3f %12.3f %12.2f\n", name, unit, error.max,
+    error.count ? sqrt(error.sum_sq / error.count) : 0., ns);
+}
+
+// Accuracy of the fixed-point trig against double precision, and its speed
+// against the float and coarse LUT code it replaced
+static void bench_trig(uint32_t calls) {
+  printf("\n%-14s %12s %12s %12s %12s\n",
+    "function", "error unit", "max error", "rms error", "ns/call");
+
+  Error e_sine, e_old_sine, e_sin8, e_point, e_old_point, e_atan;
+  for (uint16_t x = 0; x < 256; ++x) {
+    double exact = (sin(x * M_PI / 128) + 1) * 0.5 * (old::RESOLUTION - 1);
+    e_sine.add(uint_sine(x) - exact);
+    e_old_sine.add(old::uint_sine(x) - exact);
+    e_sin8.add(sin8(x) - sin(x * M_PI / 128) * 256);
+    e_point.add(point_x(x) - (cos(x * M_PI / 128) + 1) * 0.5 * (old::RESOLUTION - 1));
+  }
+  for (uint16_t deg = 0; deg < 359; ++deg) {
+    e_old_point.add(old::point_x(deg) - (cos(deg * M_PI / 180) + 1) * 0.5 * (old::RESOLUTION - 1));
+  }
+  for (int16_t y = -64; y <= 64; ++y) {
+    for (int16_t x = -64; x <= 64; ++x) {
+      if (x == 0 && y == 0) continue;
+      double exact = atan2(y, x) * 128 / M_PI;
+      double error = atan2_8(y, x) - exact;
+      while (error >= 128) error -= 256;
+      while (error < -128) error += 256;
+      e_atan.add(error);
+    }
+  }
+
+  print_trig("uint_sine", "DAC step", e_sine, time_calls(calls, [](uint32_t i) { return uint_sine(i); }));
+  print_trig("uint_sine/old", "DAC step", e_old_sine, time_calls(calls, [](uint32_t i) { return old::uint_sine(i); }));
+  print_trig("sin8", "1/256", e_sin8, time_calls(calls, [](uint32_t i) { return sin8(i); }));
+  print_trig("point", "DAC step", e_point, time_calls(calls, [](uint32_t i) { return point_x(i); }));
+  print_trig("point/float", "DAC step", e_old_point, time_calls(calls, [](uint32_t i) { return old::point_x(i % 359); }));
+  Transform transform;
+  transform.set(37, 200, 32, 32);
+  print_trig("transform", "-", Error(), time_calls(calls, [&](uint32_t i) {
+    return transform.x(int8_t(i), int8_t(i >> 8)) + transform.y(int8_t(i), int8_t(i >> 8));
+  }));
+  print_trig("atan2_8", "1/256 turn", e_atan, time_calls(calls, [](uint32_t i) { return atan2_8(int8_t(i), int8_t(i >> 8)); }));
+  print_trig("atan2/float", "1/256 turn", Error(), time_calls(calls, [](uint32_t i) {
+    return int32_t(atan2(int8_t(i), int8_t(i >> 8)) * 128 / M_PI);
+  }));
+}
+
+int main(int argc, char* argv[]) {
+  if (argc > 1 && strcmp(argv[1], "--pty") == 0) return run_pty();
+
+  uint32_t frames = argc > 1 ? atol(argv[1]) : 256;
+  if (frames == 0) frames = 1;
+
+  printf("%-12s %12s %12s %12s %12s %12s\n",
+    "mode", "writes/frm", "redund/frm", "travel/frm", "hold us/frm", "ns/point");
+  for (const Mode& mode : MODES) {
+    randomSeed(1);
+    set_scan(mode.scan);
+    run_command(set_settle, "0 0 0 0 0 0 0");
+    g_detail_level = 0;
+    IdleFn idle_fn = mode.init_fn();
+    g_stats = Stats{};
+    g_last_x = g_last_y = -1;
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t frame = 0; frame < frames; ++frame) {
+      for (uint16_t i = 0; i < mode.calls_per_frame; ++i) {
+        idle_fn();
+      }
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    double ns = std::chrono::duration<double, std::nano>(elapsed).count();
+
+    // A scan order only applies if the spans fit; say so when they didn't
+    bool fallback = strcmp(mode.scan, "raster") != 0 && spans_overflowed();
+    printf("%-12s %12.1f %12.1f %12.1f %12.1f %12.2f%s\n", mode.name,
+      double(g_stats.writes) / frames,
+      double(g_stats.redundant) / frames,
+      double(g_stats.travel) / frames,
+      double(g_stats.hold_us) / frames,
+      g_stats.writes ? ns / g_stats.writes : 0.,
+      fallback ? "  raster fallback" : "");
+  }
+
+  bench_trig(frames * 4096);
+  return 0;
+}
@@ -0,0 +1,82 @@
+// Copyright (c) 2022 Trevor Makes
+
+#include "native.hpp"
+
+#include <chrono>
+#include <poll.h>
+#include <stdio.h>
+#include <unistd.h>
+
+StreamEx g_serial_ex;
+HostSerial Serial;
+
+void StreamEx::print(const char* str) { if (!muted) fputs(str, stdout); }
+void StreamEx::print(long n) { if (!muted) printf("%ld", n); }
+void StreamEx::println(const char* str) { if (!muted) puts(str); }
+void StreamEx::println(long n) { if (!muted) printf("%ld\n", n); }
+
+// Bytes read from the descriptor but not yet consumed
+static uint8_t g_rx_buffer[64];
+static uint8_t g_rx_head;
+static uint8_t g_rx_tail;
+
+int HostSerial::available() {
+  if (g_rx_head == g_rx_tail && fd >= 0) {
+    pollfd pfd = { fd, POLLIN, 0 };
+    if (poll(&pfd, 1, 0) > 0 && (pfd.revents & POLLIN)) {
+      ssize_t n = ::read(fd, g_rx_buffer, sizeof(g_rx_buffer));
+      g_rx_head = 0;
+      g_rx_tail = n > 0 ? n : 0;
+    }
+  }
+  return g_rx_tail - g_rx_head;
+}
+
+int HostSerial::read() {
+  return available() > 0 ? g_rx_buffer[g_rx_head++] : -1;
+}
+
+size_t HostSerial::write(uint8_t byte) {
+  return fd >= 0 && ::write(fd, &byte, 1) == 1 ? 1 : 0;
+}
+
+static const auto g_start = std::chrono::steady_clock::now();
+
+unsigned long micros() {
+  auto elapsed = std::chrono::steady_clock::now() - g_start;
+  return std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+}
+
+unsigned long millis() {
+  return micros() / 1000;
+}
+
+void delayMicroseconds(unsigned int) {
+  // Dwell is accounted for by DAC::hold rather than actually waited out
+}
+
+// Same generator as avr-libc random() so sequences match the board
+static uint32_t g_random_next = 1;
+
+static int32_t do_random() {
+  int32_t x = g_random_next;
+  if (x == 0) x = 123459876L;
+  int32_t hi = x / 127773L;
+  int32_t lo = x % 127773L;
+  x = 16807L * lo - 2836L * hi;
+  if (x < 0) x += 0x7FFFFFFFL;
+  g_random_next = x;
+  return x;
+}
+
+long random(long howbig) {
+  return howbig == 0 ? 0 : do_random() % howbig;
+}
+
+long random(long howsmall, long howbig) {
+  return howsmall >= howbig ? howsmall : random(howbig - howsmall) + howsmall;
+}
+
+void randomSeed(unsigned long seed) {
+  if (seed != 0) g_random_next = seed;
+}
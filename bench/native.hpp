@@ -0,0 +1,81 @@
+// Copyright (c) 2022 Trevor Makes
+
+#pragma once
+
+// Stand-ins for the parts of the Arduino API and core CLI used by the drawing
+// code, so it can be built and benchmarked on the host (see env:native)
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+// Flash and RAM share one address space on the host
+#define PROGMEM
+inline uint8_t pgm_read_byte(const void* addr) { return *(const uint8_t*)addr; }
+inline uint16_t pgm_read_word(const void* addr) { return *(const uint16_t*)addr; }
+inline void* memcpy_P(void* dest, const void* src, size_t n) { return memcpy(dest, src, n); }
+inline int strcmp_P(const char* a, const char* b) { return strcmp(a, b); }
+#define PSTR(str) (str)
+
+#define radians(deg) ((deg) * M_PI / 180.0)
+// Strings stay in RAM, so flash string pointers are plain char pointers
+using __FlashStringHelper = char;
+#define F(str) (str)
+
+unsigned long millis();
+unsigned long micros();
+void delayMicroseconds(unsigned int us);
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+
+using IdleFn = void (*)();
+
+// Prints to stdout in place of the serial connection
+struct StreamEx {
+  bool muted = false;
+
+  void print(const char* str);
+  void print(long n);
+  void println(const char* str = "");
+  void println(long n);
+};
+
+// Serial port backed by a file descriptor, so streaming mode can be driven
+// from a pty (see bench --pty)
+struct HostSerial {
+  int fd = -1;
+
+  void begin(unsigned long) {}
+  void flush() {}
+  int available();
+  int read();
+  size_t write(uint8_t byte);
+};
+
+extern HostSerial Serial;
+
+// Splits a mutable string into whitespace separated arguments
+class Args {
+  char* cursor_;
+
+  void skip_space() {
+    while (cursor_ && *cursor_ == ' ') ++cursor_;
+  }
+
+public:
+  explicit Args(char* line = nullptr): cursor_(line) { skip_space(); }
+
+  bool has_next() { return cursor_ && *cursor_ != '\0'; }
+
+  const char* next() {
+    if (!has_next()) return "";
+    char* arg = cursor_;
+    while (*cursor_ != '\0' && *cursor_ != ' ') ++cursor_;
+    if (*cursor_ != '\0') *cursor_++ = '\0';
+    skip_space();
+    return arg;
+  }
+};
@@ -0,0 +1,256 @@
+// Copyright (c) 2022 Trevor Makes
+
+// Cycle-accurate frame cost of each display mode, measured by running the
+// nano_bench firmware under simavr. The firmware toggles D2 once per idle
+// call; PORTB/PORTC writes are counted between those edges. The sample rate
+// and jitter of the dds command are measured from the spacing of PORTB writes.
+// If a trace file is given, every write in the measured frames is also logged
+// as CSV with its cycle timestamp, counted from the start of the first frame.
+//
+// Untested: not yet built or run against simavr, so no reference numbers exist.
+//
+// Usage: bench_avr firmware.elf [frames=16] [hold=0,3,10] [trace.csv]
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <simavr/sim_avr.h>
+#include <simavr/sim_elf.h>
+#include <simavr/avr_ioport.h>
+#include <simavr/avr_uart.h>
+
+#define F_CPU 16000000UL
+#define MARKER_PORT 'D'
+#define MARKER_PIN 2
+#define EOL "\r"
+
+// At 9600 baud each character takes ~1 ms, leave a little extra
+#define UART_GAP (F_CPU / 800)
+#define BOOT_CYCLES (F_CPU / 10)
+#define WARMUP_FRAMES 2
+#define MAX_HOLDS 8
+
+typedef struct {
+  const char* name;
+  const char* command;
+  unsigned calls_per_frame; // Idle calls needed to trace the whole figure
+} Mode;
+
+static const Mode MODES[] = {
+  { "circle", "circle", 1 },
+  { "cross", "cross", 1 },
+  { "bounce", "bounce", 1 },
+  { "circum", "circum", 1 },
+  { "spin", "spin", 1 },
+  { "cube", "cube", 1 },
+  { "ico", "ico", 1 },
+  { "curves", "curves", 1 },
+  { "lissajous", "lissajous 5 6", 1 },
+  { "bitmap", "doge", 1 },
+  { "logo", "logo", 1 },
+  { "vlogo", "vlogo", 1 },
+};
+
+// Sawtooth whose 64 steps each last one sample at the default 40 kHz rate,
+// so every sample changes X
+#define DDS_COMMAND "dds x saw 625"
+#define DDS_SAMPLES 4096
+
+static avr_t* g_avr;
+static uint32_t g_writes; // Running count of PORTB and PORTC writes
+static uint32_t g_marks; // Running count of marker edges
+
+// Window of marker edges to measure and the state captured at each end
+static uint32_t g_mark_begin, g_mark_end;
+static avr_cycle_count_t g_cycle_begin, g_cycle_end;
+static uint32_t g_writes_begin, g_writes_end;
+
+// Optional log of each write in the measured frames
+static FILE* g_trace;
+static const char* g_trace_mode;
+static unsigned g_trace_hold;
+
+static void port_hook(struct avr_irq_t* irq, uint32_t value, void* param) {
+  ++g_writes;
+  if (g_trace && g_marks >= g_mark_begin && g_marks < g_mark_end) {
+    fprintf(g_trace, "%s,%u,%u,%llu,%c,%u\n", g_trace_mode, g_trace_hold,
+      g_marks - g_mark_begin, (unsigned long long)(g_avr->cycle - g_cycle_begin),
+      (char)(intptr_t)param, value & 0x3F);
+  }
+}
+
+// Spacing of PORTB writes while measuring DDS output
+static int g_dds_measure;
+static avr_cycle_count_t g_dds_last;
+static uint32_t g_dds_count;
+static uint32_t g_dds_min, g_dds_max;
+static double g_dds_sum, g_dds_sum_sq;
+
+static void dds_hook(struct avr_irq_t* irq, uint32_t value, void* param) {
+  if (!g_dds_measure) return;
+  if (g_dds_last != 0) {
+    uint32_t interval = g_avr->cycle - g_dds_last;
+    if (g_dds_count == 0 || interval < g_dds_min) g_dds_min = interval;
+    if (g_dds_count == 0 || interval > g_dds_max) g_dds_max = interval;
+    g_dds_sum += interval;
+    g_dds_sum_sq += (double)interval * interval;
+    ++g_dds_count;
+  }
+  g_dds_last = g_avr->cycle;
+}
+
+static void marker_hook(struct avr_irq_t* irq, uint32_t value, void* param) {
+  ++g_marks;
+  if (g_marks == g_mark_begin) {
+    g_cycle_begin = g_avr->cycle;
+    g_writes_begin = g_writes;
+  } else if (g_marks == g_mark_end) {
+    g_cycle_end = g_avr->cycle;
+    g_writes_end = g_writes;
+  }
+}
+
+static void run_until(avr_cycle_count_t cycle) {
+  while (g_avr->cycle < cycle) {
+    int state = avr_run(g_avr);
+    if (state == cpu_Done || state == cpu_Crashed) {
+      fprintf(stderr, "simulation stopped (state %d)\n", state);
+      exit(1);
+    }
+  }
+}
+
+static void send_line(const char* line) {
+  avr_irq_t* input = avr_io_getirq(g_avr, AVR_IOCTL_UART_GETIRQ('0'), UART_IRQ_INPUT);
+  for (const char* c = line; *c; ++c) {
+    avr_raise_irq(input, (uint8_t)*c);
+    run_until(g_avr->cycle + UART_GAP);
+  }
+  for (const char* c = EOL; *c; ++c) {
+    avr_raise_irq(input, (uint8_t)*c);
+    run_until(g_avr->cycle + UART_GAP);
+  }
+}
+
+// Returns cycles spent on the given number of idle calls, or 0 on timeout
+static avr_cycle_count_t measure(const Mode* mode, unsigned hold, unsigned frames) {
+  char line[32];
+
+  g_trace_mode = mode->name;
+  g_trace_hold = hold;
+  avr_reset(g_avr);
+  run_until(g_avr->cycle + BOOT_CYCLES);
+  snprintf(line, sizeof(line), "delay %u", hold);
+  send_line(line);
+  send_line(mode->command);
+
+  g_mark_begin = g_marks + WARMUP_FRAMES * mode->calls_per_frame;
+  g_mark_end = g_mark_begin + frames * mode->calls_per_frame;
+  g_cycle_end = 0;
+
+  // Give up if a frame takes more than a second of simulated time
+  avr_cycle_count_t timeout = g_avr->cycle + (frames + WARMUP_FRAMES + 1) * F_CPU;
+  while (g_cycle_end == 0 && g_avr->cycle < timeout) {
+    run_until(g_avr->cycle + F_CPU / 1000);
+  }
+  return g_cycle_end ? g_cycle_end - g_cycle_begin : 0;
+}
+
+static void measure_dds(void) {
+  avr_reset(g_avr);
+  run_until(g_avr->cycle + BOOT_CYCLES);
+  send_line(DDS_COMMAND);
+  // Let the command finish echoing before timing samples
+  run_until(g_avr->cycle + UART_GAP * 4);
+
+  g_dds_measure = 1;
+  g_dds_last = 0;
+  g_dds_count = 0;
+  g_dds_sum = g_dds_sum_sq = 0;
+  avr_cycle_count_t timeout = g_avr->cycle + F_CPU;
+  while (g_dds_count < DDS_SAMPLES && g_avr->cycle < timeout) {
+    run_until(g_avr->cycle + F_CPU / 1000);
+  }
+  g_dds_measure = 0;
+
+  if (g_dds_count == 0) {
+    printf("\n%s: no samples\n", DDS_COMMAND);
+    return;
+  }
+  double mean = g_dds_sum / g_dds_count;
+  double stddev = sqrt(g_dds_sum_sq / g_dds_count - mean * mean);
+  printf("\n%s: %u samples at %.1f Hz\n", DDS_COMMAND, g_dds_count, F_CPU / mean);
+  printf("sample spacing: mean %.1f, min %u, max %u, stddev %.2f cycles\n",
+    mean, g_dds_min, g_dds_max, stddev);
+}
+
+int main(int argc, char* argv[]) {
+  if (argc < 2) {
+    fprintf(stderr, "usage: %s firmware.elf [frames=16] [hold=0,3,10] [trace.csv]\n", argv[0]);
+    return 1;
+  }
+  unsigned frames = argc > 2 ? atoi(argv[2]) : 16;
+  if (frames == 0) frames = 1;
+
+  unsigned holds[MAX_HOLDS] = { 0, 3, 10 };
+  unsigned n_holds = 3;
+  if (argc > 3) {
+    n_holds = 0;
+    for (char* tok = strtok(argv[3], ","); tok && n_holds < MAX_HOLDS; tok = strtok(NULL, ",")) {
+      holds[n_holds++] = atoi(tok);
+    }
+  }
+
+  if (argc > 4) {
+    g_trace = fopen(argv[4], "w");
+    if (!g_trace) {
+      perror(argv[4]);
+      return 1;
+    }
+    fprintf(g_trace, "mode,hold,frame,cycle,port,value\n");
+  }
+
+  elf_firmware_t firmware;
+  memset(&firmware, 0, sizeof(firmware));
+  if (elf_read_firmware(argv[1], &firmware) != 0) {
+    fprintf(stderr, "unable to read %s\n", argv[1]);
+    return 1;
+  }
+
+  g_avr = avr_make_mcu_by_name("atmega328p");
+  if (!g_avr) {
+    fprintf(stderr, "simavr lacks atmega328p support\n");
+    return 1;
+  }
+  avr_init(g_avr);
+  avr_load_firmware(g_avr, &firmware);
+  g_avr->frequency = F_CPU;
+  g_avr->log = LOG_NONE;
+
+  avr_irq_register_notify(avr_io_getirq(g_avr, AVR_IOCTL_IOPORT_GETIRQ('B'), IOPORT_IRQ_REG_PORT), port_hook, (void*)'B');
+  avr_irq_register_notify(avr_io_getirq(g_avr, AVR_IOCTL_IOPORT_GETIRQ('C'), IOPORT_IRQ_REG_PORT), port_hook, (void*)'C');
+  avr_irq_register_notify(avr_io_getirq(g_avr, AVR_IOCTL_IOPORT_GETIRQ('B'), IOPORT_IRQ_REG_PORT), dds_hook, NULL);
+  avr_irq_register_notify(avr_io_getirq(g_avr, AVR_IOCTL_IOPORT_GETIRQ(MARKER_PORT), MARKER_PIN), marker_hook, NULL);
+
+  printf("%-10s %5s %12s %12s %10s\n", "mode", "hold", "cycles/frm", "points/s", "refresh Hz");
+  for (size_t i = 0; i < sizeof(MODES) / sizeof(Mode); ++i) {
+    for (unsigned h = 0; h < n_holds; ++h) {
+      const Mode* mode = &MODES[i];
+      avr_cycle_count_t cycles = measure(mode, holds[h], frames);
+      if (cycles == 0) {
+        printf("%-10s %5u %12s\n", mode->name, holds[h], "timeout");
+        continue;
+      }
+      double seconds = (double)cycles / F_CPU;
+      printf("%-10s %5u %12.0f %12.0f %10.1f\n", mode->name, holds[h],
+        (double)cycles / frames, (g_writes_end - g_writes_begin) / seconds, frames / seconds);
+    }
+  }
+
+  measure_dds();
+  if (g_trace) fclose(g_trace);
+  return 0;
+}
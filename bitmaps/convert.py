@@ -1,49 +1,167 @@
-from PIL import Image
+from PIL import Image, ImageSequence
 import sys
 
 REC_SIZE = 32
+RLE_CONTINUE = 15
+ANIM_TICK_MS = 10
 
-if len(sys.argv) != 2:
-  print(f"Usage: python3 {sys.argv[0]} [filename]")
-  quit()
-
-# Open filename passed as command line argument
-im = Image.open(sys.argv[1])
-(w, h) = im.size
-
-# Expect 1-bit image
-for (_, c) in im.getcolors():
-  assert(c in (0, 1))
-
-# Print bitmap as C PROGMEM array
-bytes = []
-print('const uint8_t ROM[BITMAP_BYTES] PROGMEM = {')
-for y in range(0, h):
-  print(' ', end='')
-  for byte_idx in range(0, w // 8):
-    byte = 0
-    for bit_idx in range(0, 8):
-      x = byte_idx * 8 + bit_idx
-      byte = byte << 1 | im.getpixel((x, y))
-    bytes.append(byte)
-    print(f' 0x{byte:02X},', end='')
-  print()
-print('};')
+# Pack pixels into bytes, MSB first, with plane() picking the bit of each pixel
+def pack_bits(im, plane):
+  (w, h) = im.size
+  bytes = []
+  for y in range(0, h):
+    for byte_idx in range(0, w // 8):
+      byte = 0
+      for bit_idx in range(0, 8):
+        x = byte_idx * 8 + bit_idx
+        byte = byte << 1 | plane(im.getpixel((x, y)))
+      bytes.append(byte)
+  return bytes
+
+# Alternating runs of unlit and lit pixels in raster order, starting unlit,
+# packed two per byte with the high nibble first. A run of RLE_CONTINUE adds
+# to the current run without switching between unlit and lit.
+def rle_nibbles(bytes):
+  nibbles = []
+  lit = 0
+  run = 0
+  for byte in bytes:
+    for bit_idx in range(7, -1, -1):
+      if (byte >> bit_idx) & 1 != lit:
+        nibbles += [RLE_CONTINUE] * (run // RLE_CONTINUE) + [run % RLE_CONTINUE]
+        lit = 1 - lit
+        run = 0
+      run += 1
+  nibbles += [RLE_CONTINUE] * (run // RLE_CONTINUE) + [run % RLE_CONTINUE]
+  if len(nibbles) % 2:
+    nibbles.append(0)
+  return [hi << 4 | lo for (hi, lo) in zip(nibbles[0::2], nibbles[1::2])]
+
+# Encode each frame as the bytes that changed since the previous frame (the
+# first frame against a blank bitmap). Layout, as read by play_anim_frame:
+#   frame count
+#   per frame: duration in ANIM_TICK_MS units, then spans of
+#     [skip, count, count bytes to XOR] ending with [0, 0]
+# `skip` advances from the end of the previous span; [255, 0] skips further.
+def delta_frames(frames, durations_ms):
+  rom = [len(frames)]
+  prev = [0] * len(frames[0])
+  for (frame, ms) in zip(frames, durations_ms):
+    rom.append(max(1, min(255, round(ms / ANIM_TICK_MS))))
+    pos = 0
+    i = 0
+    while i < len(frame):
+      if frame[i] == prev[i]:
+        i += 1
+        continue
+      # Extend span over changes, bridging single unchanged bytes which cost
+      # less than the header of a new span
+      end = i + 1
+      while end < len(frame) and end - i < 255:
+        if frame[end] != prev[end]:
+          end += 1
+        elif end + 1 < len(frame) and frame[end + 1] != prev[end + 1] and end + 2 - i <= 255:
+          end += 2
+        else:
+          break
+      skip = i - pos
+      while skip > 255:
+        rom += [255, 0]
+        skip -= 255
+      rom += [skip, end - i] + [frame[k] ^ prev[k] for k in range(i, end)]
+      pos = i = end
+    rom += [0, 0]
+    prev = frame
+  return rom
+
+def print_array(rom, array_size, width):
+  print(f'const uint8_t ROM[{array_size}] PROGMEM = {{')
+  for row in range(0, len(rom), width):
+    print(' ', end='')
+    for byte in rom[row:row + width]:
+      print(f' 0x{byte:02X},', end='')
+    print()
+  print('};')
 
 # Print bitmap as IHX string for CLI 'import' command
-address = 0
-while address < len(bytes):
-  rec = bytes[address:address+REC_SIZE]
-  size = len(rec)
-
-  print(f':{size:02X}{address:04X}00', end='')
-  checksum = size + (address >> 8) + (address & 0xFF)
-  address += REC_SIZE
-
-  for byte in rec:
-    print(f'{byte:02X}', end='')
-    checksum += byte
-
-  checksum = -checksum & 0xFF
-  print(f'{checksum:02X}')
-print(':00000001FF')
+# Grayscale images must be imported after enabling the 'gray' command
+def print_ihx(bytes):
+  address = 0
+  while address < len(bytes):
+    rec = bytes[address:address+REC_SIZE]
+    size = len(rec)
+
+    print(f':{size:02X}{address:04X}00', end='')
+    checksum = size + (address >> 8) + (address & 0xFF)
+    address += REC_SIZE
+
+    for byte in rec:
+      print(f'{byte:02X}', end='')
+      checksum += byte
+
+    checksum = -checksum & 0xFF
+    print(f'{checksum:02X}')
+  print(':00000001FF')
+
+# Frames from an animated image or a list of images, thresholded to 1-bit
+def load_frames(filenames, default_ms):
+  frames = []
+  durations = []
+  for filename in filenames:
+    for frame in ImageSequence.Iterator(Image.open(filename)):
+      lit = frame.convert('L').point(lambda p: 1 if p >= 128 else 0)
+      frames.append(pack_bits(lit, lambda p: p))
+      durations.append(frame.info.get('duration', default_ms))
+  return (frames, durations)
+
+def main(args):
+  flags = [arg for arg in args if arg.startswith('--')]
+  args = [arg for arg in args if not arg.startswith('--')]
+  gray = '--gray' in flags
+  rle = '--rle' in flags
+  anim = '--anim' in flags
+
+  if len(args) < 1 or gray + rle + anim > 1 or (len(args) > 1 and not anim):
+    print(f"Usage: python3 {sys.argv[0]} [--gray | --rle] [filename]")
+    print(f"       python3 {sys.argv[0]} --anim [--ms=100] [filename...]")
+    quit()
+
+  if anim:
+    # Print delta encoded frames as C PROGMEM array for play_anim_frame
+    ms = [int(flag[5:]) for flag in flags if flag.startswith('--ms=')]
+    (frames, durations) = load_frames(args, ms[0] if ms else 100)
+    if len(frames) > 255:
+      # The frame count is stored in one byte
+      print(f"{len(frames)} frames, but at most 255 fit in one animation", file=sys.stderr)
+      sys.exit(1)
+    rom = delta_frames(frames, durations)
+    print(f'// {len(frames)} frames, {len(rom)} bytes delta encoded')
+    print_array(rom, '', 16)
+    return
+
+  # Open filename passed as command line argument
+  im = Image.open(args[0])
+  (w, h) = im.size
+
+  if gray:
+    # Quantize to 2-bit levels, stored as a plane of low bits then high bits
+    im = im.convert('L')
+    bytes = pack_bits(im, lambda p: (p >> 6) & 1) + pack_bits(im, lambda p: p >> 7)
+  else:
+    # Expect 1-bit image
+    for (_, c) in im.getcolors():
+      assert(c in (0, 1))
+    bytes = pack_bits(im, lambda p: p)
+
+  # Print bitmap as C PROGMEM array, for unpack_bitmap if compressed
+  if rle:
+    rom = rle_nibbles(bytes)
+    print(f'// {len(rom)} bytes run-length encoded')
+    print_array(rom, '', w // 8)
+  else:
+    print_array(bytes, 'BITMAP_BYTES * 2' if gray else 'BITMAP_BYTES', w // 8)
+
+  print_ihx(bytes)
+
+if __name__ == '__main__':
+  main(sys.argv[1:])
@@ -0,0 +1,71 @@
+# Generate the built-in 'life' flipbook: one period of Conway's Game of Life
+# oscillators (a pulsar ringed by blinkers, period 6) on a 32x32 torus, drawn as 2x2 pixel cells
+from convert import delta_frames, print_array
+
+CELLS = 32
+SCALE = 2
+FRAME_MS = 100
+
+PULSAR = [
+  '..OOO...OOO..',
+  '.............',
+  'O....O.O....O',
+  'O....O.O....O',
+  'O....O.O....O',
+  '..OOO...OOO..',
+  '.............',
+  '..OOO...OOO..',
+  'O....O.O....O',
+  'O....O.O....O',
+  'O....O.O....O',
+  '.............',
+  '..OOO...OOO..',
+]
+BLINKER = ['OOO']
+
+def transpose(pattern):
+  return [''.join(row[i] for row in pattern) for i in range(len(pattern[0]))]
+
+def place(grid, pattern, ox, oy):
+  for (y, row) in enumerate(pattern):
+    for (x, c) in enumerate(row):
+      if c == 'O':
+        grid[oy + y][ox + x] = 1
+
+def step(grid):
+  def neighbors(x, y):
+    return sum(grid[(y + dy) % CELLS][(x + dx) % CELLS]
+      for dy in (-1, 0, 1) for dx in (-1, 0, 1) if dx or dy)
+  return [[1 if neighbors(x, y) == 3 or (grid[y][x] and neighbors(x, y) == 2) else 0
+    for x in range(CELLS)] for y in range(CELLS)]
+
+def to_bytes(grid):
+  bytes = []
+  for y in range(CELLS * SCALE):
+    for byte_idx in range(CELLS * SCALE // 8):
+      byte = 0
+      for bit_idx in range(8):
+        x = (byte_idx * 8 + bit_idx) // SCALE
+        byte = byte << 1 | grid[y // SCALE][x]
+      bytes.append(byte)
+  return bytes
+
+grid = [[0] * CELLS for _ in range(CELLS)]
+place(grid, PULSAR, 9, 9)
+place(grid, BLINKER, 2, 3)
+place(grid, BLINKER, 27, 3)
+place(grid, transpose(BLINKER), 3, 26)
+place(grid, transpose(BLINKER), 28, 26)
+
+# Collect frames until the pattern repeats
+frames = []
+first = grid
+while True:
+  frames.append(to_bytes(grid))
+  grid = step(grid)
+  if grid == first:
+    break
+
+rom = delta_frames(frames, [FRAME_MS] * len(frames))
+print(f'// {len(frames)} frames, {len(rom)} bytes delta encoded')
+print_array(rom, '', 16)
@@ -0,0 +1,158 @@
+// Copyright (c) 2022 Trevor Makes
+
+#include "main.hpp"
+
+// Flipbook animation stored in program memory as XOR deltas against the
+// previous frame, so each frame only touches the bytes that changed
+// (see bitmaps/convert.py --anim). Layout:
+//   frame count
+//   per frame: duration in ANIM_TICK_MS units, then spans of
+//     [skip, count, count bytes to XOR] ending with [0, 0]
+// `skip` advances from the end of the previous span; [255, 0] skips further.
+
+constexpr uint8_t ANIM_TICK_MS = 10;
+
+constexpr uint8_t BITMAP_ROWS = DAC::Y::RESOLUTION;
+constexpr uint8_t BITMAP_COL_BYTES = DAC::X::RESOLUTION / 8;
+constexpr uint16_t BITMAP_BYTES = BITMAP_ROWS * BITMAP_COL_BYTES;
+
+extern bool g_bitmap_dirty;
+
+uint8_t* bitmap_row(uint8_t row);
+void clear_bitmap();
+
+static const uint8_t* g_anim_rom; // Start of the animation
+static const uint8_t* g_anim_next; // Next frame to apply
+static uint8_t g_anim_frames_left;
+static uint16_t g_anim_duration; // Time to show the current frame in ms
+static unsigned long g_anim_time; // millis() when the current frame was shown
+
+// Apply the next frame to the bitmap and advance to the one after
+// Offsets count from the top left of the screen, wherever the row ring starts.
+static void play_anim_frame() {
+  const uint8_t* source = g_anim_next;
+  g_anim_duration = pgm_read_byte(source++) * ANIM_TICK_MS;
+  uint16_t offset = 0;
+  for (;;) {
+    uint8_t skip = pgm_read_byte(source++);
+    uint8_t count = pgm_read_byte(source++);
+    if (skip == 0 && count == 0) break;
+    offset += skip;
+    for (; count > 0; --count, ++offset) {
+      uint8_t delta = pgm_read_byte(source++);
+      // Bytes past the end of the bitmap are read but not applied
+      if (offset < BITMAP_BYTES) {
+        bitmap_row(offset / BITMAP_COL_BYTES)[offset % BITMAP_COL_BYTES] ^= delta;
+      }
+    }
+  }
+  g_anim_next = source;
+  --g_anim_frames_left;
+  g_bitmap_dirty = true;
+}
+
+// The first frame is a delta against a blank bitmap
+static void rewind_anim() {
+  clear_bitmap();
+  g_anim_frames_left = pgm_read_byte(g_anim_rom);
+  g_anim_next = g_anim_rom + 1;
+  play_anim_frame();
+}
+
+void anim_idle() {
+  unsigned long now = millis();
+  if (now - g_anim_time >= g_anim_duration) {
+    g_anim_time = now;
+    if (g_anim_frames_left == 0) {
+      rewind_anim();
+    } else {
+      play_anim_frame();
+    }
+  }
+  bitmap_idle();
+}
+
+IdleFn play_anim(const uint8_t* rom) {
+  g_anim_rom = rom;
+  g_anim_time = millis();
+  rewind_anim();
+  return anim_idle;
+}
+
+extern const uint8_t LIFE_ANIM[] PROGMEM;
+
+IdleFn init_life() {
+  return play_anim(LIFE_ANIM);
+}
+
+// Game of Life pulsar and blinkers from bitmaps/life.py,
+// 6 frames, 1063 bytes delta encoded
+const uint8_t LIFE_ANIM[] PROGMEM = {
+  0x06, 0x0A, 0x30, 0x02, 0x0F, 0xC0, 0x04, 0x04, 0x03, 0xF0, 0x0F, 0xC0, 0x04, 0x02, 0x03, 0xF0,
+  0x52, 0x03, 0x03, 0xF0, 0x3F, 0x05, 0x03, 0x03, 0xF0, 0x3F, 0x15, 0x04, 0x30, 0x0C, 0xC0, 0x30,
+  0x04, 0x04, 0x30, 0x0C, 0xC0, 0x30, 0x04, 0x04, 0x30, 0x0C, 0xC0, 0x30, 0x04, 0x04, 0x30, 0x0C,
+  0xC0, 0x30, 0x04, 0x04, 0x30, 0x0C, 0xC0, 0x30, 0x04, 0x04, 0x30, 0x0C, 0xC0, 0x30, 0x04, 0x03,
+  0x03, 0xF0, 0x3F, 0x05, 0x03, 0x03, 0xF0, 0x3F, 0x15, 0x03, 0x03, 0xF0, 0x3F, 0x05, 0x03, 0x03,
+  0xF0, 0x3F, 0x05, 0x04, 0x30, 0x0C, 0xC0, 0x30, 0x04, 0x04, 0x30, 0x0C, 0xC0, 0x30, 0x04, 0x04,
+  0x30, 0x0C, 0xC0, 0x30, 0x04, 0x04, 0x30, 0x0C, 0xC0, 0x30, 0x04, 0x04, 0x30, 0x0C, 0xC0, 0x30,
+  0x04, 0x04, 0x30, 0x0C, 0xC0, 0x30, 0x14, 0x03, 0x03, 0xF0, 0x3F, 0x05, 0x03, 0x03, 0xF0, 0x3F,
+  0x43, 0x01, 0x03, 0x06, 0x02, 0xC0, 0x03, 0x06, 0x02, 0xC0, 0x03, 0x06, 0x02, 0xC0, 0x03, 0x06,
+  0x02, 0xC0, 0x03, 0x06, 0x02, 0xC0, 0x03, 0x06, 0x01, 0xC0, 0x00, 0x00, 0x0A, 0x20, 0x01, 0x03,
+  0x06, 0x02, 0xC0, 0x03, 0x06, 0x03, 0xC0, 0x0C, 0xC0, 0x04, 0x04, 0x03, 0x30, 0x0C, 0xC0, 0x04,
+  0x03, 0x03, 0x30, 0x03, 0x06, 0x02, 0xC0, 0x03, 0x06, 0x01, 0xC0, 0x33, 0x02, 0xC0, 0x0C, 0x06,
+  0x02, 0xC0, 0x0C, 0x05, 0x03, 0x03, 0x30, 0x33, 0x05, 0x03, 0x03, 0x30, 0x33, 0x06, 0x02, 0xF0,
+  0x3C, 0x06, 0x02, 0xF0, 0x3C, 0x05, 0x04, 0x30, 0x0C, 0xC0, 0x30, 0x04, 0x04, 0x30, 0x0C, 0xC0,
+  0x30, 0x04, 0x04, 0xCC, 0x30, 0x30, 0xCC, 0x04, 0x04, 0xCC, 0x30, 0x30, 0xCC, 0x04, 0x04, 0x3C,
+  0xC0, 0x0C, 0xF0, 0x04, 0x04, 0x3C, 0xC0, 0x0C, 0xF0, 0x04, 0x03, 0x03, 0x00, 0x03, 0x05, 0x03,
+  0x03, 0x00, 0x03, 0x15, 0x03, 0x03, 0x00, 0x03, 0x05, 0x03, 0x03, 0x00, 0x03, 0x05, 0x04, 0x3C,
+  0xC0, 0x0C, 0xF0, 0x04, 0x04, 0x3C, 0xC0, 0x0C, 0xF0, 0x04, 0x04, 0xCC, 0x30, 0x30, 0xCC, 0x04,
+  0x04, 0xCC, 0x30, 0x30, 0xCC, 0x04, 0x04, 0x30, 0x0C, 0xC0, 0x30, 0x04, 0x04, 0x30, 0x0C, 0xC0,
+  0x30, 0x05, 0x02, 0xF0, 0x3C, 0x06, 0x02, 0xF0, 0x3C, 0x05, 0x03, 0x03, 0x30, 0x33, 0x05, 0x03,
+  0x03, 0x30, 0x33, 0x06, 0x02, 0xC0, 0x0C, 0x06, 0x02, 0xC0, 0x0C, 0x33, 0x01, 0x03, 0x06, 0x02,
+  0xC0, 0x03, 0x06, 0x03, 0xC0, 0x0C, 0xC0, 0x04, 0x04, 0x03, 0x30, 0x0C, 0xC0, 0x04, 0x03, 0x03,
+  0x30, 0x03, 0x06, 0x02, 0xC0, 0x03, 0x06, 0x01, 0xC0, 0x00, 0x00, 0x0A, 0x20, 0x01, 0x03, 0x06,
+  0x02, 0xC0, 0x03, 0x06, 0x03, 0xC0, 0x0C, 0xC0, 0x04, 0x04, 0x03, 0x30, 0x0C, 0xC0, 0x04, 0x03,
+  0x03, 0x30, 0x03, 0x06, 0x02, 0xC0, 0x03, 0x06, 0x01, 0xC0, 0x33, 0x02, 0xC0, 0x0C, 0x06, 0x02,
+  0xC0, 0x0C, 0x05, 0x03, 0x03, 0x00, 0x03, 0x05, 0x03, 0x03, 0x00, 0x03, 0x15, 0x04, 0x30, 0xCC,
+  0xCC, 0x30, 0x04, 0x04, 0x30, 0xCC, 0xCC, 0x30, 0x04, 0x04, 0xC3, 0x00, 0x03, 0x0C, 0x04, 0x04,
+  0xC3, 0x00, 0x03, 0x0C, 0x14, 0x03, 0x03, 0x00, 0x03, 0x05, 0x03, 0x03, 0x00, 0x03, 0x15, 0x03,
+  0x03, 0x00, 0x03, 0x05, 0x03, 0x03, 0x00, 0x03, 0x15, 0x04, 0xC3, 0x00, 0x03, 0x0C, 0x04, 0x04,
+  0xC3, 0x00, 0x03, 0x0C, 0x04, 0x04, 0x30, 0xCC, 0xCC, 0x30, 0x04, 0x04, 0x30, 0xCC, 0xCC, 0x30,
+  0x14, 0x03, 0x03, 0x00, 0x03, 0x05, 0x03, 0x03, 0x00, 0x03, 0x06, 0x02, 0xC0, 0x0C, 0x06, 0x02,
+  0xC0, 0x0C, 0x33, 0x01, 0x03, 0x06, 0x02, 0xC0, 0x03, 0x06, 0x03, 0xC0, 0x0C, 0xC0, 0x04, 0x04,
+  0x03, 0x30, 0x0C, 0xC0, 0x04, 0x03, 0x03, 0x30, 0x03, 0x06, 0x02, 0xC0, 0x03, 0x06, 0x01, 0xC0,
+  0x00, 0x00, 0x0A, 0x20, 0x01, 0x03, 0x06, 0x02, 0xC0, 0x03, 0x06, 0x03, 0xC0, 0x0C, 0xC0, 0x04,
+  0x04, 0x03, 0x30, 0x0C, 0xC0, 0x04, 0x03, 0x03, 0x30, 0x03, 0x06, 0x02, 0xC0, 0x03, 0x06, 0x01,
+  0xC0, 0x43, 0x02, 0x30, 0x30, 0x06, 0x02, 0x30, 0x30, 0x06, 0x02, 0xF0, 0x3C, 0x06, 0x02, 0xF0,
+  0x3C, 0x06, 0x02, 0xC0, 0x0C, 0x06, 0x02, 0xC0, 0x0C, 0x05, 0x04, 0x0F, 0x30, 0x33, 0xC0, 0x04,
+  0x04, 0x0F, 0x30, 0x33, 0xC0, 0x04, 0x04, 0x3C, 0xC0, 0x0C, 0xF0, 0x04, 0x04, 0x3C, 0xC0, 0x0C,
+  0xF0, 0x34, 0x04, 0x3C, 0xC0, 0x0C, 0xF0, 0x04, 0x04, 0x3C, 0xC0, 0x0C, 0xF0, 0x04, 0x04, 0x0F,
+  0x30, 0x33, 0xC0, 0x04, 0x04, 0x0F, 0x30, 0x33, 0xC0, 0x05, 0x02, 0xC0, 0x0C, 0x06, 0x02, 0xC0,
+  0x0C, 0x06, 0x02, 0xF0, 0x3C, 0x06, 0x02, 0xF0, 0x3C, 0x06, 0x02, 0x30, 0x30, 0x06, 0x02, 0x30,
+  0x30, 0x43, 0x01, 0x03, 0x06, 0x02, 0xC0, 0x03, 0x06, 0x03, 0xC0, 0x0C, 0xC0, 0x04, 0x04, 0x03,
+  0x30, 0x0C, 0xC0, 0x04, 0x03, 0x03, 0x30, 0x03, 0x06, 0x02, 0xC0, 0x03, 0x06, 0x01, 0xC0, 0x00,
+  0x00, 0x0A, 0x20, 0x01, 0x03, 0x06, 0x02, 0xC0, 0x03, 0x06, 0x03, 0xC0, 0x0C, 0xC0, 0x04, 0x04,
+  0x03, 0x30, 0x0C, 0xC0, 0x04, 0x03, 0x03, 0x30, 0x03, 0x06, 0x02, 0xC0, 0x03, 0x06, 0x01, 0xC0,
+  0x33, 0x02, 0xC0, 0x0C, 0x06, 0x02, 0xC0, 0x0C, 0x05, 0x03, 0x03, 0x30, 0x33, 0x05, 0x03, 0x03,
+  0x30, 0x33, 0x06, 0x02, 0xF0, 0x3C, 0x06, 0x02, 0xF0, 0x3C, 0x05, 0x04, 0x30, 0x0C, 0xC0, 0x30,
+  0x04, 0x04, 0x30, 0x0C, 0xC0, 0x30, 0x04, 0x04, 0xCC, 0x30, 0x30, 0xCC, 0x04, 0x04, 0xCC, 0x30,
+  0x30, 0xCC, 0x04, 0x04, 0x3C, 0xC0, 0x0C, 0xF0, 0x04, 0x04, 0x3C, 0xC0, 0x0C, 0xF0, 0x04, 0x03,
+  0x03, 0x00, 0x03, 0x05, 0x03, 0x03, 0x00, 0x03, 0x15, 0x03, 0x03, 0x00, 0x03, 0x05, 0x03, 0x03,
+  0x00, 0x03, 0x05, 0x04, 0x3C, 0xC0, 0x0C, 0xF0, 0x04, 0x04, 0x3C, 0xC0, 0x0C, 0xF0, 0x04, 0x04,
+  0xCC, 0x30, 0x30, 0xCC, 0x04, 0x04, 0xCC, 0x30, 0x30, 0xCC, 0x04, 0x04, 0x30, 0x0C, 0xC0, 0x30,
+  0x04, 0x04, 0x30, 0x0C, 0xC0, 0x30, 0x05, 0x02, 0xF0, 0x3C, 0x06, 0x02, 0xF0, 0x3C, 0x05, 0x03,
+  0x03, 0x30, 0x33, 0x05, 0x03, 0x03, 0x30, 0x33, 0x06, 0x02, 0xC0, 0x0C, 0x06, 0x02, 0xC0, 0x0C,
+  0x33, 0x01, 0x03, 0x06, 0x02, 0xC0, 0x03, 0x06, 0x03, 0xC0, 0x0C, 0xC0, 0x04, 0x04, 0x03, 0x30,
+  0x0C, 0xC0, 0x04, 0x03, 0x03, 0x30, 0x03, 0x06, 0x02, 0xC0, 0x03, 0x06, 0x01, 0xC0, 0x00, 0x00,
+  0x0A, 0x20, 0x01, 0x03, 0x06, 0x02, 0xC0, 0x03, 0x06, 0x03, 0xC0, 0x0C, 0xC0, 0x04, 0x04, 0x03,
+  0x30, 0x0C, 0xC0, 0x04, 0x03, 0x03, 0x30, 0x03, 0x06, 0x02, 0xC0, 0x03, 0x06, 0x01, 0xC0, 0x33,
+  0x02, 0xC0, 0x0C, 0x06, 0x02, 0xC0, 0x0C, 0x05, 0x03, 0x03, 0x00, 0x03, 0x05, 0x03, 0x03, 0x00,
+  0x03, 0x15, 0x04, 0x30, 0xCC, 0xCC, 0x30, 0x04, 0x04, 0x30, 0xCC, 0xCC, 0x30, 0x04, 0x04, 0xC3,
+  0x00, 0x03, 0x0C, 0x04, 0x04, 0xC3, 0x00, 0x03, 0x0C, 0x14, 0x03, 0x03, 0x00, 0x03, 0x05, 0x03,
+  0x03, 0x00, 0x03, 0x15, 0x03, 0x03, 0x00, 0x03, 0x05, 0x03, 0x03, 0x00, 0x03, 0x15, 0x04, 0xC3,
+  0x00, 0x03, 0x0C, 0x04, 0x04, 0xC3, 0x00, 0x03, 0x0C, 0x04, 0x04, 0x30, 0xCC, 0xCC, 0x30, 0x04,
+  0x04, 0x30, 0xCC, 0xCC, 0x30, 0x14, 0x03, 0x03, 0x00, 0x03, 0x05, 0x03, 0x03, 0x00, 0x03, 0x06,
+  0x02, 0xC0, 0x0C, 0x06, 0x02, 0xC0, 0x0C, 0x33, 0x01, 0x03, 0x06, 0x02, 0xC0, 0x03, 0x06, 0x03,
+  0xC0, 0x0C, 0xC0, 0x04, 0x04, 0x03, 0x30, 0x0C, 0xC0, 0x04, 0x03, 0x03, 0x30, 0x03, 0x06, 0x02,
+  0xC0, 0x03, 0x06, 0x01, 0xC0, 0x00, 0x00,
+};
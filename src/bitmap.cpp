@@ -2,10 +2,12 @@
 
 #include "main.hpp"
 
+#if !defined(NATIVE)
 #include "core/mon.hpp"
 #include "core/io/bus.hpp"
 
 #include <EEPROM.h>
+#endif
 
 constexpr uint8_t BITMAP_ROWS = DAC::Y::RESOLUTION;
 constexpr uint8_t BITMAP_COL_BITS = DAC::X::RESOLUTION;
@@ -13,12 +15,91 @@ constexpr uint8_t BITS_PER_BYTE = 8;
 constexpr uint8_t BITMAP_COL_BYTES = BITMAP_COL_BITS / BITS_PER_BYTE;
 constexpr size_t BITMAP_BYTES = BITMAP_ROWS * BITMAP_COL_BYTES;
 
-uint8_t BITMAP_RAM[BITMAP_BYTES];
+// The first half holds the 1-bit image (or the low bit of each pixel in
+// grayscale mode). In grayscale mode, the second half holds the high bit of
+// each pixel; otherwise it is scratch space for the compiled span list.
+uint8_t BITMAP_RAM[BITMAP_BYTES * 2];
 
+// Rows are stored as a ring: screen row 0 is kept at row g_top_row of
+// BITMAP_RAM and the rows below follow on, wrapping around to the start. This
+// lets the image scroll by moving the top row instead of the whole bitmap.
+uint8_t g_top_row = 0;
+static_assert((BITMAP_ROWS & (BITMAP_ROWS - 1)) == 0, "ring size must be a power of 2");
+
+// Storage for the given screen row, in the first half of BITMAP_RAM
+uint8_t* bitmap_row(uint8_t row) {
+  return BITMAP_RAM + ((g_top_row + row) & (BITMAP_ROWS - 1)) * BITMAP_COL_BYTES;
+}
+
+static uint8_t g_delay = 3;
+
+// Pixel hold as set by `delay`, divided by 2^level when the frame governor
+// sheds detail
 static uint8_t g_pixel_hold = 3;
+static uint8_t g_hold_level = 0; // Detail level g_pixel_hold was computed for
+
+// Pixel hold for each grayscale level, proportional to intensity
+static uint8_t g_gray_hold[4];
+bool g_gray = false;
+
+static void update_pixel_hold() {
+  g_hold_level = g_detail_level;
+  g_pixel_hold = g_delay >> g_hold_level;
+  for (uint8_t level = 0; level < 4; ++level) {
+    uint16_t hold = g_pixel_hold * level;
+    g_gray_hold[level] = hold > 0xFF ? 0xFF : hold;
+  }
+}
 
 void set_delay(Args args) {
-  g_pixel_hold = atoi(args.next());
+  g_delay = atoi(args.next());
+  update_pixel_hold();
+}
+
+// Extra hold for the beam to settle after a jump, by the bit length of the
+// jump distance in DAC steps (the larger of X and Y): 0, 1, 2-3, 4-7, 8-15,
+// 16-31 and 32-63. All zero by default; tune with `settle` while watching
+// the scope, which may allow a shorter `delay` for every other pixel.
+constexpr uint8_t SETTLE_STEPS = 7;
+static uint8_t g_settle_hold[SETTLE_STEPS];
+static bool g_settle = false; // Set if any settle hold is non-zero
+
+static uint8_t distance(uint8_t a, uint8_t b) {
+  return a < b ? b - a : a - b;
+}
+
+static void settle(uint8_t dist) {
+  uint8_t step = 0;
+  for (; dist != 0; dist >>= 1) ++step;
+  uint8_t hold = g_settle_hold[step];
+  if (hold) DAC::hold(hold);
+}
+
+// Beam position in the raster scan, for settling
+static uint8_t g_beam_x, g_beam_y;
+
+// Settle before holding a raster pixel at (x, y)
+static void settle_at(uint8_t x, uint8_t y) {
+  uint8_t dx = distance(x, g_beam_x);
+  uint8_t dy = distance(y, g_beam_y);
+  settle(dx > dy ? dx : dy);
+  g_beam_x = x;
+  g_beam_y = y;
+}
+
+void set_settle(Args args) {
+  for (uint8_t i = 0; i < SETTLE_STEPS && args.has_next(); ++i) {
+    g_settle_hold[i] = atoi(args.next());
+  }
+  g_settle = false;
+  for (uint8_t i = 0; i < SETTLE_STEPS; ++i) {
+    g_serial_ex.print(i == 0 ? 0 : 1 << (i - 1));
+    g_serial_ex.print(F(":"));
+    g_serial_ex.print(g_settle_hold[i]);
+    g_serial_ex.print(F(" "));
+    if (g_settle_hold[i]) g_settle = true;
+  }
+  g_serial_ex.println();
 }
 
 template <bool FLIP_H>
@@ -34,72 +115,641 @@ void write_bits(uint8_t x, const uint8_t y, uint8_t bits) {
     if (FLIP_H) --x; // Pre-decrement if reversed
     if (bits & 0x80) {
       DAC::X::write(x); // Draw if MSB set
-      delayMicroseconds(g_pixel_hold);
+      if (g_settle) settle_at(x, y);
+      DAC::hold(g_pixel_hold);
     }
     if (!FLIP_H) ++x; // Post-decrement if forwards
   } while ((bits <<= 1) > 0); // Shift next bit into MSB
 }
 
+// Like write_bits, but holding each pixel according to its 2-bit level
+template <bool FLIP_H>
+void write_gray_bits(uint8_t x, const uint8_t y, uint8_t low, uint8_t high) {
+  // Skip blank scanlines
+  if ((low | high) == 0) return;
+
+  DAC::Y::write(y);
+  do {
+    if (FLIP_H) --x;
+    uint8_t level = ((high >> 6) & 2) | (low >> 7);
+    if (level) {
+      DAC::X::write(x);
+      if (g_settle) settle_at(x, y);
+      DAC::hold(g_gray_hold[level]);
+    }
+    if (!FLIP_H) ++x;
+    low <<= 1;
+    high <<= 1;
+  } while ((low | high) != 0);
+}
+
+// Occupied bytes of each screen row, indexed whenever the bitmap changes so
+// the raster scan can jump past blank rows and the blank ends of rows. Each
+// row packs its first and last non-blank byte into the high and low nibbles.
+// A clear bit in the row mask marks a group of 8 blank rows.
+constexpr uint8_t ROW_EMPTY = 0xF0; // First after last
+static uint8_t g_row_extent[BITMAP_ROWS];
+static uint8_t g_row_mask[BITMAP_ROWS / 8];
+
+// Spans along the rows of the 1-bit image, kept up to date as rows are
+// indexed so a change to a few rows can tell whether the spans would fit
+static uint16_t g_row_spans = 0;
+
+static uint8_t count_row_spans(uint8_t row) {
+  const uint8_t* bitmap_ptr = bitmap_row(row);
+  uint8_t count = 0;
+  uint8_t prev = 0;
+  for (uint8_t col = 0; col < BITMAP_COL_BYTES; ++col) {
+    uint8_t bits = bitmap_ptr[col];
+    // Lit pixels whose left neighbour is unlit, with the high bit leftmost
+    uint8_t starts = bits & ~(bits >> 1 | prev << 7);
+    for (; starts != 0; starts &= starts - 1) ++count;
+    prev = bits;
+  }
+  return count;
+}
+
+static void index_row(uint8_t row) {
+  g_row_spans += count_row_spans(row);
+  const uint8_t* bitmap_ptr = bitmap_row(row);
+  uint8_t first = BITMAP_COL_BYTES;
+  uint8_t last = 0;
+  for (uint8_t col = 0; col < BITMAP_COL_BYTES; ++col) {
+    uint8_t bits = bitmap_ptr[col];
+    if (g_gray) bits |= bitmap_ptr[col + BITMAP_BYTES];
+    if (bits == 0) continue;
+    if (first == BITMAP_COL_BYTES) first = col;
+    last = col;
+  }
+  g_row_extent[row] = first == BITMAP_COL_BYTES ? ROW_EMPTY : first << 4 | last;
+}
+
+static void mask_rows() {
+  memset(g_row_mask, 0, sizeof(g_row_mask));
+  for (uint8_t row = 0; row < BITMAP_ROWS; ++row) {
+    if (g_row_extent[row] != ROW_EMPTY) g_row_mask[row / 8] |= 1 << (row % 8);
+  }
+}
+
+static void index_rows() {
+  g_row_spans = 0;
+  for (uint8_t row = 0; row < BITMAP_ROWS; ++row) {
+    index_row(row);
+  }
+  mask_rows();
+}
+
 // Trace set bitmap pixels with X and Y
-template <bool FLIP_H, bool FLIP_V>
+template <bool FLIP_H, bool FLIP_V, bool GRAY>
 void draw_bitmap() {
-  const uint8_t* bitmap_ptr = BITMAP_RAM;
-  // For row in [0, BITMAP_ROWS), reversed if FLIP_V set
-  for (uint8_t row = FLIP_V ? BITMAP_ROWS : 0; ; ) {
-    // Pre-decrement row if reversed
-    if (FLIP_V) {
-      if (row == 0) break;
-      --row;
+  for (uint8_t row = 0; row < BITMAP_ROWS; ++row) {
+    // Skip groups of blank rows, then blank rows
+    if (row % 8 == 0 && g_row_mask[row / 8] == 0) {
+      row += 7;
+      continue;
     }
-    // For col in [0, BITMAP_ROWS), reversed if FLIP_H set
-    for (uint8_t col = FLIP_H ? BITMAP_COL_BITS : 0; ; ) {
-      write_bits<FLIP_H>(col, row, *bitmap_ptr++);
-      // Post-increment/decrement col
-      if (FLIP_H) {
-        col -= BITS_PER_BYTE;
-        if (col == 0) break;
+    uint8_t extent = g_row_extent[row];
+    if (extent == ROW_EMPTY) continue;
+
+    // Rows are traced top to bottom, with Y reversed if FLIP_V set
+    uint8_t y = FLIP_V ? BITMAP_ROWS - 1 - row : row;
+    const uint8_t* bitmap_ptr = bitmap_row(row);
+    // For each occupied byte, starting X from the right edge if FLIP_H set
+    for (uint8_t col = extent >> 4; col <= (extent & 0x0F); ++col) {
+      uint8_t x = FLIP_H ? BITMAP_COL_BITS - col * BITS_PER_BYTE : col * BITS_PER_BYTE;
+      if (GRAY) {
+        write_gray_bits<FLIP_H>(x, y, bitmap_ptr[col], bitmap_ptr[col + BITMAP_BYTES]);
       } else {
-        col += BITS_PER_BYTE;
-        if (col == BITMAP_COL_BITS) break;
+        write_bits<FLIP_H>(x, y, bitmap_ptr[col]);
       }
     }
-    // Post-increment row if forwards
-    if (!FLIP_V) {
-      ++row;
-      if (row == BITMAP_ROWS) break;
-    }
   }
 }
 
 bool g_flip_v = true;
 bool g_flip_h = true;
 
-void bitmap_idle() {
+// Set by anything that modifies BITMAP_RAM or the flip state
+bool g_bitmap_dirty = true;
+
+// Screen rows [begin, end) modified since the last frame, for changes that
+// only touch a few rows and can be indexed and compiled on their own
+static uint8_t g_dirty_begin = BITMAP_ROWS;
+static uint8_t g_dirty_end = 0;
+
+// Call before modifying the rows. Their spans are taken out of the count
+// until they are indexed again.
+void mark_rows_dirty(uint8_t begin, uint8_t end) {
+  if (begin >= end) return;
+  uint8_t old_begin = g_dirty_begin;
+  uint8_t old_end = g_dirty_end;
+  if (old_begin >= old_end) old_begin = old_end = begin;
+  g_dirty_begin = begin < old_begin ? begin : old_begin;
+  g_dirty_end = end > old_end ? end : old_end;
+  if (g_bitmap_dirty) return;
+  for (uint8_t row = g_dirty_begin; row < old_begin; ++row) {
+    g_row_spans -= count_row_spans(row);
+  }
+  for (uint8_t row = old_end; row < g_dirty_end; ++row) {
+    g_row_spans -= count_row_spans(row);
+  }
+}
+
+// Run of lit pixels along a row (or a column when g_span_columns is set),
+// traced from `from` to `to` inclusive
+struct Span { uint8_t line; uint8_t from; uint8_t to; };
+
+// Spans share the second half of BITMAP_RAM with the grayscale high bits
+constexpr uint8_t MAX_SPANS = BITMAP_BYTES / sizeof(Span);
+constexpr uint8_t SPANS_OVERFLOW = 0xFF;
+static Span* const g_spans = reinterpret_cast<Span*>(BITMAP_RAM + BITMAP_BYTES);
+static uint8_t g_num_spans = SPANS_OVERFLOW;
+
+// Set while an import is staged in span memory
+static bool g_staging = false;
+
+// Called when span memory is taken back from the mode borrowing it
+static void (*g_scratch_release)() = nullptr;
+
+void reclaim_scratch() {
+  void (*release)() = g_scratch_release;
+  g_scratch_release = nullptr;
+  if (release) release();
+}
+static bool g_span_columns = false;
+
+enum ScanOrder : uint8_t {
+  SCAN_RASTER, // Rows in order, each left to right
+  SCAN_SERPENTINE, // Rows in order, alternating direction
+  SCAN_COLUMNS, // Columns in order, each top to bottom
+  SCAN_NEAREST, // Greedily jump to the nearest remaining span
+};
+
+static ScanOrder g_scan_order = SCAN_RASTER;
+
+// Append pixel to the open span or start a new one; false if the list has
+// reached `limit` spans
+static bool add_span_pixel(uint8_t& n_spans, uint8_t limit, bool& in_span, uint8_t line, uint8_t pos) {
+  if (in_span) {
+    g_spans[n_spans - 1].to = pos;
+    return true;
+  }
+  if (n_spans == limit) return false;
+  g_spans[n_spans++] = { line, pos, pos };
+  in_span = true;
+  return true;
+}
+
+// Collect spans along rows [begin, end), skipping blank bytes, appending to
+// the first `n_spans` spans. Returns the new count, or SPANS_OVERFLOW if there
+// would be more than `limit`.
+static uint8_t compile_rows(uint8_t n_spans, uint8_t begin, uint8_t end, uint8_t limit) {
+  for (uint8_t row = begin; row < end; ++row) {
+    uint8_t y = g_flip_v ? BITMAP_ROWS - 1 - row : row;
+    const uint8_t* bitmap_ptr = bitmap_row(row);
+    bool in_span = false;
+    uint8_t bits = 0;
+    for (uint8_t col = 0; col < BITMAP_COL_BITS; ++col) {
+      if (col % BITS_PER_BYTE == 0) {
+        bits = *bitmap_ptr++;
+        // Skip blank bytes unless a span is open
+        if (bits == 0 && !in_span) {
+          col += BITS_PER_BYTE - 1;
+          continue;
+        }
+      }
+      uint8_t x = g_flip_h ? BITMAP_COL_BITS - 1 - col : col;
+      if (bits & 0x80) {
+        if (!add_span_pixel(n_spans, limit, in_span, y, x)) return SPANS_OVERFLOW;
+      } else {
+        in_span = false;
+      }
+      bits <<= 1;
+    }
+  }
+  return n_spans;
+}
+
+// Collect spans down each column
+static uint8_t compile_columns() {
+  uint8_t n_spans = 0;
+  for (uint8_t col = 0; col < BITMAP_COL_BITS; ++col) {
+    uint8_t x = g_flip_h ? BITMAP_COL_BITS - 1 - col : col;
+    const uint8_t* bitmap_ptr = bitmap_row(0) + col / BITS_PER_BYTE;
+    uint8_t mask = 0x80 >> (col % BITS_PER_BYTE);
+    bool in_span = false;
+    for (uint8_t row = 0; row < BITMAP_ROWS; ++row) {
+      uint8_t y = g_flip_v ? BITMAP_ROWS - 1 - row : row;
+      if (*bitmap_ptr & mask) {
+        if (!add_span_pixel(n_spans, MAX_SPANS, in_span, x, y)) return SPANS_OVERFLOW;
+      } else {
+        in_span = false;
+      }
+      bitmap_ptr += BITMAP_COL_BYTES;
+      if (bitmap_ptr >= BITMAP_RAM + BITMAP_BYTES) bitmap_ptr -= BITMAP_BYTES;
+    }
+  }
+  return n_spans;
+}
+
+static void reverse_span(Span& span) {
+  uint8_t from = span.from;
+  span.from = span.to;
+  span.to = from;
+}
+
+// Reverse the order and direction of spans on every other line
+static void make_serpentine() {
+  bool reverse = false;
+  for (uint8_t begin = 0; begin < g_num_spans; ) {
+    uint8_t end = begin + 1;
+    while (end < g_num_spans && g_spans[end].line == g_spans[begin].line) ++end;
+    if (reverse) {
+      for (uint8_t i = begin, j = end - 1; i < j; ++i, --j) {
+        Span temp = g_spans[i];
+        g_spans[i] = g_spans[j];
+        g_spans[j] = temp;
+      }
+      for (uint8_t i = begin; i < end; ++i) {
+        reverse_span(g_spans[i]);
+      }
+    }
+    reverse = !reverse;
+    begin = end;
+  }
+}
+
+// Greedily order spans so each starts at whichever remaining span end is
+// closest to the end of the previous span
+static void make_nearest() {
+  uint8_t line = g_spans[0].line;
+  uint8_t pos = g_spans[0].to;
+  for (uint8_t i = 1; i < g_num_spans; ++i) {
+    uint8_t best = i;
+    uint16_t best_dist = 0xFFFF;
+    bool best_reversed = false;
+    for (uint8_t j = i; j < g_num_spans; ++j) {
+      const Span& span = g_spans[j];
+      uint16_t line_dist = distance(line, span.line);
+      uint16_t from_dist = line_dist + distance(pos, span.from);
+      uint16_t to_dist = line_dist + distance(pos, span.to);
+      if (from_dist < best_dist) {
+        best = j;
+        best_dist = from_dist;
+        best_reversed = false;
+      }
+      if (to_dist < best_dist) {
+        best = j;
+        best_dist = to_dist;
+        best_reversed = true;
+      }
+    }
+    Span temp = g_spans[i];
+    g_spans[i] = g_spans[best];
+    g_spans[best] = temp;
+    if (best_reversed) reverse_span(g_spans[i]);
+    line = g_spans[i].line;
+    pos = g_spans[i].to;
+  }
+}
+
+// Convert bitmap into a list of spans with flips applied, in the selected
+// scan order. If the image has too many spans, the list is marked as
+// overflowed and the bitmap is scanned in raster order instead.
+void compile_spans() {
+  // Span memory holds the high bits in grayscale mode, or an import in progress
+  if (g_gray || g_staging) {
+    g_num_spans = SPANS_OVERFLOW;
+    return;
+  }
+  reclaim_scratch();
+  g_span_columns = g_scan_order == SCAN_COLUMNS;
+  g_num_spans = g_span_columns ? compile_columns() : compile_rows(0, 0, BITMAP_ROWS, MAX_SPANS);
+  if (g_num_spans == SPANS_OVERFLOW || g_num_spans == 0) return;
+  if (g_scan_order == SCAN_SERPENTINE) {
+    make_serpentine();
+  } else if (g_scan_order == SCAN_NEAREST) {
+    make_nearest();
+  }
+}
+
+// Screen row of a span in raster order
+static uint8_t span_row(const Span& span) {
+  return g_flip_v ? BITMAP_ROWS - 1 - span.line : span.line;
+}
+
+// Index of the first span on or below screen row `row`, in raster order
+static uint8_t find_row_span(uint8_t row) {
+  uint8_t i = 0;
+  while (i < g_num_spans && span_row(g_spans[i]) < row) ++i;
+  return i;
+}
+
+// Raster spans are sorted by row and don't depend on their neighbours, so
+// changed rows can be recompiled without the rest of the image
+static bool can_update_rows() {
+  return g_scan_order == SCAN_RASTER && g_num_spans != SPANS_OVERFLOW;
+}
+
+// Recompile the spans on screen rows [begin, end), keeping the others
+static void update_rows(uint8_t begin, uint8_t end) {
+  uint8_t first = find_row_span(begin);
+  uint8_t last = first;
+  while (last < g_num_spans && span_row(g_spans[last]) < end) ++last;
+  // Park the spans below the changed rows at the top of span memory
+  uint8_t tail = g_num_spans - last;
+  memmove(g_spans + MAX_SPANS - tail, g_spans + last, tail * sizeof(Span));
+  uint8_t n_spans = compile_rows(first, begin, end, MAX_SPANS - tail);
+  if (n_spans == SPANS_OVERFLOW) {
+    g_num_spans = SPANS_OVERFLOW;
+    return;
+  }
+  memmove(g_spans + n_spans, g_spans + MAX_SPANS - tail, tail * sizeof(Span));
+  g_num_spans = n_spans + tail;
+}
+
+// Drop the spans on the top `rows` screen rows and move the rest up
+static void scroll_spans(uint8_t rows) {
+  uint8_t first = find_row_span(rows);
+  g_num_spans -= first;
+  memmove(g_spans, g_spans + first, g_num_spans * sizeof(Span));
+  for (uint8_t i = 0; i < g_num_spans; ++i) {
+    g_spans[i].line += g_flip_v ? rows : -rows;
+  }
+}
+
+// True if the image had too many spans and is scanned in raster order
+bool spans_overflowed() {
+  return g_num_spans == SPANS_OVERFLOW;
+}
+
+// Sum of X and Y steps taken by the beam over one pass of the span list,
+// including the jump from the last span back to the first
+static uint16_t span_travel() {
+  if (g_num_spans == 0) return 0;
+  const Span* last = &g_spans[g_num_spans - 1];
+  uint8_t line = last->line;
+  uint8_t pos = last->to;
+  uint16_t travel = 0;
+  for (uint8_t i = 0; i < g_num_spans; ++i) {
+    const Span& span = g_spans[i];
+    travel += distance(line, span.line) + distance(pos, span.from);
+    travel += distance(span.from, span.to);
+    line = span.line;
+    pos = span.to;
+  }
+  return travel;
+}
+
+// Trace each span, writing the line coordinate only when it changes
+template <bool COLUMNS>
+void draw_spans() {
+  if (g_num_spans == 0) return;
+  const Span* end = g_spans + g_num_spans;
+  uint8_t line = 0xFF;
+  // Settle from where the previous frame left the beam
+  uint8_t last_line = end[-1].line;
+  uint8_t last_pos = end[-1].to;
+  for (const Span* span = g_spans; span != end; ++span) {
+    if (span->line != line) {
+      line = span->line;
+      if (COLUMNS) {
+        DAC::X::write(line);
+      } else {
+        DAC::Y::write(line);
+      }
+    }
+    int8_t step = span->from <= span->to ? 1 : -1;
+    for (uint8_t pos = span->from; ; pos += step) {
+      if (COLUMNS) {
+        DAC::Y::write(pos);
+      } else {
+        DAC::X::write(pos);
+      }
+      if (g_settle && pos == span->from) {
+        uint8_t dl = distance(line, last_line);
+        uint8_t dp = distance(pos, last_pos);
+        settle(dl > dp ? dl : dp);
+        last_line = line;
+        last_pos = span->to;
+      }
+      DAC::hold(g_pixel_hold);
+      if (pos == span->to) break;
+    }
+  }
+}
+
+template <bool GRAY>
+void draw_bitmap_flipped() {
   if (g_flip_h) {
     if (g_flip_v) {
-      draw_bitmap<true, true>();
+      draw_bitmap<true, true, GRAY>();
     } else {
-      draw_bitmap<true, false>();
+      draw_bitmap<true, false, GRAY>();
     }
   } else {
     if (g_flip_v) {
-      draw_bitmap<false, true>();
+      draw_bitmap<false, true, GRAY>();
+    } else {
+      draw_bitmap<false, false, GRAY>();
+    }
+  }
+}
+
+void bitmap_idle() {
+  if (g_bitmap_dirty) {
+    g_bitmap_dirty = false;
+    index_rows();
+    compile_spans();
+  } else if (g_dirty_begin < g_dirty_end) {
+    for (uint8_t row = g_dirty_begin; row < g_dirty_end; ++row) {
+      index_row(row);
+    }
+    mask_rows();
+    if (can_update_rows()) {
+      update_rows(g_dirty_begin, g_dirty_end);
+    } else if (g_scan_order == SCAN_COLUMNS || g_row_spans <= MAX_SPANS) {
+      compile_spans();
+    } else {
+      // Still too many spans, so skip compiling them
+      g_num_spans = SPANS_OVERFLOW;
+    }
+  }
+  g_dirty_begin = BITMAP_ROWS;
+  g_dirty_end = 0;
+  if (g_hold_level != g_detail_level) update_pixel_hold();
+
+  if (g_gray) {
+    draw_bitmap_flipped<true>();
+  } else if (g_num_spans != SPANS_OVERFLOW) {
+    if (g_span_columns) {
+      draw_spans<true>();
     } else {
-      draw_bitmap<false, false>();
+      draw_spans<false>();
     }
+  } else {
+    draw_bitmap_flipped<false>();
+  }
+}
+
+// Scroll the image up, clearing the rows that come in at the bottom. The row
+// index and spans are moved up with the image, so only the new rows need to
+// be compiled.
+void scroll_bitmap(uint8_t rows) {
+  if (!g_bitmap_dirty) {
+    // Take the rows leaving the top out of the span count, unless already out
+    for (uint8_t row = 0; row < rows; ++row) {
+      if (row < g_dirty_begin || row >= g_dirty_end) g_row_spans -= count_row_spans(row);
+    }
+  }
+  g_top_row = (g_top_row + rows) & (BITMAP_ROWS - 1);
+  for (uint8_t row = BITMAP_ROWS - rows; row < BITMAP_ROWS; ++row) {
+    memset(bitmap_row(row), 0, BITMAP_COL_BYTES);
+    if (g_gray) memset(bitmap_row(row) + BITMAP_BYTES, 0, BITMAP_COL_BYTES);
   }
+  if (g_bitmap_dirty) return;
+  memmove(g_row_extent, g_row_extent + rows, BITMAP_ROWS - rows);
+  memset(g_row_extent + BITMAP_ROWS - rows, ROW_EMPTY, rows);
+  mask_rows();
+  if (can_update_rows()) scroll_spans(rows);
+  // Rows already waiting to be indexed have moved up too
+  if (g_dirty_end > rows) {
+    g_dirty_begin = g_dirty_begin > rows ? g_dirty_begin - rows : 0;
+    g_dirty_end -= rows;
+  } else {
+    g_dirty_begin = BITMAP_ROWS;
+    g_dirty_end = 0;
+  }
+  mark_rows_dirty(BITMAP_ROWS - rows, BITMAP_ROWS);
 }
 
 void flip_vertical(Args) {
   g_flip_v = !g_flip_v;
+  g_bitmap_dirty = true;
 }
 
 void flip_horizontal(Args) {
   g_flip_h = !g_flip_h;
+  g_bitmap_dirty = true;
+}
+
+void set_scan_order(Args args) {
+  if (args.has_next()) {
+    const char* order = args.next();
+    if (strcmp_P(order, PSTR("raster")) == 0) {
+      g_scan_order = SCAN_RASTER;
+    } else if (strcmp_P(order, PSTR("serp")) == 0) {
+      g_scan_order = SCAN_SERPENTINE;
+    } else if (strcmp_P(order, PSTR("column")) == 0) {
+      g_scan_order = SCAN_COLUMNS;
+    } else if (strcmp_P(order, PSTR("nearest")) == 0) {
+      g_scan_order = SCAN_NEAREST;
+    } else {
+      g_serial_ex.println(F("expected raster, serp, column or nearest"));
+      return;
+    }
+    compile_spans();
+  }
+
+  // Report beam travel so orders can be compared on the current image
+  if (g_num_spans == SPANS_OVERFLOW) {
+    g_serial_ex.println(F("too many spans, scanning in raster order"));
+  } else {
+    g_serial_ex.print(g_num_spans);
+    g_serial_ex.print(F(" spans, travel "));
+    g_serial_ex.println(span_travel());
+  }
+}
+
+// Lend span memory to another mode while no image data is kept there.
+// Returns nullptr in grayscale mode or while an import is staged; otherwise
+// spans are rebuilt the next time the bitmap is drawn. `release` is called
+// when the memory is taken back for another use.
+uint8_t* borrow_scratch(void (*release)()) {
+  if (g_gray || g_staging) return nullptr;
+  if (g_scratch_release != release) reclaim_scratch();
+  g_scratch_release = release;
+  g_num_spans = SPANS_OVERFLOW;
+  g_bitmap_dirty = true;
+  return BITMAP_RAM + BITMAP_BYTES;
+}
+
+// Toggle 2-bit grayscale, where the second half of BITMAP_RAM holds the high
+// bit of each pixel. Entering grayscale clears the high bits, so follow with
+// `import` or `load` to fill in both halves.
+void toggle_gray(Args) {
+  g_gray = !g_gray;
+  if (g_gray) {
+    reclaim_scratch();
+    memset(BITMAP_RAM + BITMAP_BYTES, 0, BITMAP_BYTES);
+    update_pixel_hold();
+  }
+  g_bitmap_dirty = true;
+  g_idle_fn = bitmap_idle;
+}
+
+// Unpack run-length encoded image from program memory (see convert.py --rle)
+// Nibbles alternate between runs of unlit and lit pixels, starting unlit. A
+// run of RLE_CONTINUE adds to the current run without switching.
+constexpr uint8_t RLE_CONTINUE = 15;
+constexpr uint16_t BITMAP_BITS = BITMAP_BYTES * BITS_PER_BYTE;
+
+void unpack_bitmap(const uint8_t* source) {
+  memset(BITMAP_RAM, 0, BITMAP_BYTES);
+  g_top_row = 0;
+  uint16_t pos = 0;
+  bool lit = false;
+  bool low_nibble = false;
+  uint8_t packed = 0;
+  while (pos < BITMAP_BITS) {
+    uint8_t run;
+    if (low_nibble) {
+      run = packed & 0x0F;
+    } else {
+      packed = pgm_read_byte(source++);
+      run = packed >> 4;
+    }
+    low_nibble = !low_nibble;
+    if (lit) {
+      // Set bits one at a time to the end of the run
+      for (uint8_t i = 0; i < run && pos < BITMAP_BITS; ++i, ++pos) {
+        BITMAP_RAM[pos / BITS_PER_BYTE] |= 0x80 >> (pos % BITS_PER_BYTE);
+      }
+    } else {
+      pos += run;
+    }
+    if (run != RLE_CONTINUE) lit = !lit;
+  }
+  g_gray = false;
+  g_bitmap_dirty = true;
+}
+
+
+#if !defined(NATIVE)
+// Number of bytes making up the image in the current mode
+static uint16_t image_bytes() {
+  return g_gray ? BITMAP_BYTES * 2 : BITMAP_BYTES;
+}
+
+static void reverse_bytes(uint8_t* begin, uint8_t* end) {
+  while (begin < --end) {
+    uint8_t temp = *begin;
+    *begin++ = *end;
+    *end = temp;
+  }
 }
 
-void copy_bitmap(const uint8_t* source) {
-  memcpy_P(BITMAP_RAM, source, BITMAP_BYTES);
+// Rotate the ring of rows in place so screen row 0 is stored first, for the
+// commands that treat the image as a flat run of bytes
+static void unroll_bitmap() {
+  if (g_top_row == 0) return;
+  uint16_t split = g_top_row * BITMAP_COL_BYTES;
+  for (uint8_t* plane = BITMAP_RAM; plane < BITMAP_RAM + image_bytes(); plane += BITMAP_BYTES) {
+    reverse_bytes(plane, plane + split);
+    reverse_bytes(plane + split, plane + BITMAP_BYTES);
+    reverse_bytes(plane, plane + BITMAP_BYTES);
+  }
+  g_top_row = 0;
 }
 
 struct API : public core::mon::Base<API> {
@@ -108,36 +758,165 @@ struct API : public core::mon::Base<API> {
 };
 
 void export_bitmap(Args) {
-  core::mon::impl_export<API>(0, BITMAP_BYTES);
+  unroll_bitmap();
+  core::mon::impl_export<API>(0, image_bytes());
+}
+
+static int8_t hex_digit(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  return -1;
+}
+
+// Incremental IHX parser, fed one character at a time
+struct IHXRecord {
+  enum : uint8_t { WAIT_START, READ_HEX, DONE, FAILED } state = WAIT_START;
+  uint16_t index = 0; // Bytes decoded: length, address (2), type, data, checksum
+  uint8_t length = 0;
+  uint16_t address = 0;
+  uint8_t type = 0;
+  uint8_t sum = 0;
+  int8_t high = -1; // First nibble of the current byte, or -1
+};
+
+// Decode the next byte of a record, writing data bytes to `dest` and moving
+// `end` past the highest byte written
+static void ihx_byte(IHXRecord& rec, uint8_t byte, uint8_t* dest, uint16_t size, uint16_t& end) {
+  rec.sum += byte;
+  switch (rec.index++) {
+    case 0: rec.length = byte; return;
+    case 1: rec.address = byte << 8; return;
+    case 2: rec.address |= byte; return;
+    case 3: rec.type = byte; return;
+  }
+  uint16_t offset = rec.index - 5;
+  if (offset < rec.length) {
+    if (rec.type != 0x00) {
+      // Only data records are written; other records are checksummed only
+    } else if (rec.address + offset < size) {
+      dest[rec.address + offset] = byte;
+      if (rec.address + offset >= end) end = rec.address + offset + 1;
+    } else {
+      rec.state = IHXRecord::FAILED;
+    }
+  } else {
+    // Checksum makes the sum of all bytes zero
+    rec.state = rec.sum == 0 ? IHXRecord::DONE : IHXRecord::FAILED;
+  }
+}
+
+// Read IHX records into `dest` until the EOF record, calling the idle function
+// between reads so the current mode keeps running. Sets `end` one past the
+// highest byte written. Returns the number of bad records, IHX_CANCELLED if
+// anything other than IHX records was received, or IHX_TIMED_OUT if nothing
+// arrived for IHX_TIMEOUT_MS.
+constexpr uint16_t IHX_TIMEOUT_MS = 10000;
+
+uint8_t read_ihx(uint8_t* dest, uint16_t size, uint16_t& end) {
+  IHXRecord rec;
+  uint8_t errors = 0;
+  end = 0;
+  uint32_t last_rx = millis();
+  for (;;) {
+    if (millis() - last_rx > IHX_TIMEOUT_MS) return IHX_TIMED_OUT;
+    while (Serial.available() > 0) {
+      last_rx = millis();
+      char c = Serial.read();
+      if (c == ':' || c == '\r' || c == '\n') {
+        // A record cut short by the next one or by a line break is bad
+        if (rec.state == IHXRecord::READ_HEX && errors < IHX_TIMED_OUT - 1) ++errors;
+        rec = IHXRecord();
+        if (c == ':') rec.state = IHXRecord::READ_HEX;
+      } else if (rec.state == IHXRecord::READ_HEX) {
+        int8_t digit = hex_digit(c);
+        if (digit < 0) {
+          rec.state = IHXRecord::FAILED;
+        } else if (rec.high < 0) {
+          rec.high = digit;
+        } else {
+          ihx_byte(rec, rec.high << 4 | digit, dest, size, end);
+          rec.high = -1;
+        }
+        if (rec.state == IHXRecord::FAILED) {
+          if (errors < IHX_TIMED_OUT - 1) ++errors;
+        } else if (rec.state == IHXRecord::DONE && rec.type == 0x01) {
+          return errors; // EOF record
+        }
+      } else if (rec.state != IHXRecord::FAILED) {
+        return IHX_CANCELLED;
+      }
+    }
+    budget_idle();
+  }
 }
 
-void import_bitmap(Args args) {
-  core::mon::cmd_import<API>(args);
+// 1-bit images are staged in span memory and only replace the bitmap once the
+// EOF record arrives with every checksum valid. Grayscale images fill all of
+// BITMAP_RAM, so they are written in place.
+void import_bitmap(Args) {
+  unroll_bitmap();
+  uint8_t* dest = BITMAP_RAM;
+  if (!g_gray) {
+    // Start from the current image so records not sent keep their contents
+    reclaim_scratch();
+    g_staging = true;
+    g_num_spans = SPANS_OVERFLOW;
+    dest += BITMAP_BYTES;
+    memcpy(dest, BITMAP_RAM, BITMAP_BYTES);
+  }
+
+  uint16_t end;
+  uint8_t errors = read_ihx(dest, image_bytes(), end);
+  g_staging = false;
+  g_bitmap_dirty = true;
+  if (errors == IHX_CANCELLED) {
+    g_serial_ex.println(F("import cancelled"));
+    return;
+  } else if (errors == IHX_TIMED_OUT) {
+    g_serial_ex.println(F("import timed out"));
+    return;
+  } else if (errors > 0) {
+    g_serial_ex.print(F("bad records: "));
+    g_serial_ex.println(errors);
+    if (dest != BITMAP_RAM) return;
+  } else if (dest != BITMAP_RAM) {
+    memcpy(BITMAP_RAM, dest, BITMAP_BYTES);
+  }
   g_idle_fn = bitmap_idle;
 }
 
 // save and load need the same validation and it's more convenient as a macro
+// Grayscale images are twice the size, so they use two slots each
 #define VALIDATE_ADDRESS(NAME, ARGS) \
   uint16_t NAME; \
   { \
     uint8_t index = atoi(ARGS.next()); \
-    if ((index + 1) * BITMAP_BYTES > EEPROM.length()) { \
-      g_serial_ex.println("invalid index"); \
+    if ((index + 1) * image_bytes() > EEPROM.length()) { \
+      g_serial_ex.println(F("invalid index")); \
       return; \
     } \
-    NAME = index * BITMAP_BYTES; \
+    NAME = index * image_bytes(); \
   }
 
 void save_bitmap(Args args) {
   VALIDATE_ADDRESS(address, args);
-  EEPROM.put(address, BITMAP_RAM);
+  unroll_bitmap();
+  for (uint16_t i = 0; i < image_bytes(); ++i) {
+    EEPROM.update(address + i, BITMAP_RAM[i]);
+  }
 }
 
 void load_bitmap(Args args) {
   VALIDATE_ADDRESS(address, args);
-  EEPROM.get(address, BITMAP_RAM);
+  g_top_row = 0;
+  for (uint16_t i = 0; i < image_bytes(); ++i) {
+    BITMAP_RAM[i] = EEPROM.read(address + i);
+  }
+  g_bitmap_dirty = true;
   g_idle_fn = bitmap_idle;
 }
+#endif
 
 extern const uint8_t DOGE_ROM[] PROGMEM;
 extern const uint8_t PEPE_ROM[] PROGMEM;
@@ -145,293 +924,212 @@ extern const uint8_t REEE_ROM[] PROGMEM;
 extern const uint8_t WOJAK_ROM[] PROGMEM;
 
 IdleFn init_doge() {
-  copy_bitmap(DOGE_ROM);
+  unpack_bitmap(DOGE_ROM);
   return bitmap_idle;
 }
 
 IdleFn init_pepe() {
-  copy_bitmap(PEPE_ROM);
+  unpack_bitmap(PEPE_ROM);
   return bitmap_idle;
 }
 
 IdleFn init_reee() {
-  copy_bitmap(REEE_ROM);
+  unpack_bitmap(REEE_ROM);
   return bitmap_idle;
 }
 
 IdleFn init_wojak() {
-  copy_bitmap(WOJAK_ROM);
+  unpack_bitmap(WOJAK_ROM);
   return bitmap_idle;
 }
 
-// 64x64 1-bit doge.png
-const uint8_t DOGE_ROM[BITMAP_BYTES] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x18, 0x00,
-  0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x7C, 0x00,
-  0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0xD4, 0x00,
-  0x00, 0x00, 0x3D, 0x80, 0x00, 0x01, 0xAA, 0x00,
-  0x00, 0x00, 0x1E, 0x80, 0x00, 0x03, 0xEA, 0x00,
-  0x00, 0x00, 0x1B, 0xC0, 0x00, 0x0E, 0xB6, 0x00,
-  0x00, 0x00, 0x3D, 0x40, 0x00, 0x0F, 0xAA, 0x00,
-  0x00, 0x00, 0x3A, 0xF0, 0x00, 0x3A, 0xD5, 0x00,
-  0x00, 0x00, 0x3F, 0xFF, 0x64, 0x3A, 0xAB, 0x00,
-  0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD6, 0xAB, 0x00,
-  0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x75, 0x55, 0x00,
-  0x00, 0x00, 0xFF, 0xEF, 0xFE, 0x95, 0x15, 0x00,
-  0x00, 0x01, 0xFF, 0xEB, 0xFF, 0xD6, 0x8B, 0x00,
-  0x00, 0x03, 0xFF, 0xBF, 0xFF, 0xAA, 0x36, 0x00,
-  0x00, 0x0F, 0xFF, 0xAA, 0xDF, 0xD5, 0x16, 0x00,
-  0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xEA, 0x5A, 0x00,
-  0x00, 0x3F, 0xFF, 0x5F, 0xF7, 0xF4, 0x2E, 0x00,
-  0x00, 0x7F, 0xFF, 0xFF, 0xDF, 0xFA, 0xD2, 0x00,
-  0x00, 0x7F, 0xFF, 0x5F, 0xEB, 0xFF, 0x5E, 0x00,
-  0x00, 0xFC, 0x3D, 0xBF, 0xFF, 0xFE, 0xEB, 0x00,
-  0x01, 0xFF, 0x1F, 0xBF, 0xF5, 0xFF, 0xAB, 0x80,
-  0x01, 0xFC, 0x7F, 0xFF, 0xFE, 0xFF, 0xD5, 0x80,
-  0x01, 0xFE, 0x1F, 0xFE, 0x2F, 0xFF, 0xF5, 0x80,
-  0x03, 0xFA, 0x7F, 0xF5, 0x97, 0xFF, 0xEB, 0x80,
-  0x03, 0xFF, 0x7F, 0xD1, 0x03, 0xFF, 0xF5, 0xC0,
-  0x03, 0xFF, 0xFF, 0xD2, 0x0F, 0xFF, 0xFB, 0xC0,
-  0x07, 0xFF, 0xFF, 0xD9, 0x17, 0xFF, 0xFD, 0xC0,
-  0x07, 0xFF, 0xFF, 0xEA, 0xBF, 0xFF, 0xFB, 0xC0,
-  0x07, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFB, 0xC0,
-  0x07, 0xF5, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-  0x07, 0xD5, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-  0x0F, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-  0x0F, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-  0x07, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-  0x0F, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFB, 0xF0,
-  0x0F, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0xF0,
-  0x0F, 0xE0, 0xAF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF0,
-  0x0F, 0x90, 0x5F, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0,
-  0x0F, 0xAA, 0x2B, 0xFF, 0xFF, 0xFF, 0xF5, 0x78,
-  0x0F, 0xC1, 0x5E, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8,
-  0x07, 0xE0, 0x2B, 0xD7, 0xFF, 0xFF, 0xFA, 0xBC,
-  0x0F, 0xD0, 0x1E, 0xAF, 0xFF, 0xFF, 0xEF, 0xF8,
-  0x07, 0xE8, 0x04, 0x17, 0xFF, 0xFF, 0xF5, 0x7C,
-  0x07, 0xF5, 0x42, 0xDF, 0xFF, 0xFF, 0xEF, 0xBC,
-  0x07, 0xFD, 0x75, 0x5F, 0xFF, 0xFF, 0xFA, 0xDE,
-  0x03, 0xFA, 0xAE, 0xFF, 0xFF, 0xFF, 0xAD, 0x7E,
-  0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xAE,
-  0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5A, 0xFE,
-  0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0xAE,
-  0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xED, 0xFE,
-  0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xB5, 0x5E,
-  0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFE,
-  0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6D, 0xFE,
-  0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xDB, 0xFE,
-  0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFE,
-  0x01, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE,
-  0x03, 0xFF, 0xFF, 0x55, 0xBF, 0xFF, 0xBF, 0xFE,
-  0x03, 0xFF, 0xAA, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE,
-  0x03, 0xFF, 0xFF, 0x57, 0xFF, 0xFF, 0xFF, 0xFE,
-  0x03, 0xFF, 0xEB, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE,
-  0x03, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+// 64x64 1-bit doge.png, 419 bytes run-length encoded
+const uint8_t DOGE_ROM[] PROGMEM = {
+  0xFF, 0xFF, 0xF9, 0x1F, 0xFF, 0xF2, 0x3F, 0xFF,
+  0xF0, 0x5F, 0xD2, 0xFF, 0x02, 0x12, 0xFA, 0x5F,
+  0xE2, 0x12, 0xF9, 0x21, 0x11, 0x1F, 0xD4, 0x12,
+  0xF7, 0x21, 0x11, 0x11, 0x1F, 0xD4, 0x11, 0xF6,
+  0x51, 0x11, 0x1F, 0xD2, 0x14, 0xF3, 0x31, 0x11,
+  0x21, 0x2F, 0xC4, 0x11, 0x11, 0xF3, 0x51, 0x11,
+  0x11, 0x1F, 0xC3, 0x11, 0x14, 0xE3, 0x11, 0x12,
+  0x11, 0x11, 0x11, 0xFB, 0xE1, 0x22, 0x14, 0x31,
+  0x11, 0x11, 0x11, 0x11, 0x2F, 0xB1, 0x1F, 0x71,
+  0x11, 0x21, 0x11, 0x11, 0x11, 0x2F, 0xAF, 0x81,
+  0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1F, 0x9B,
+  0x1B, 0x11, 0x21, 0x11, 0x11, 0x31, 0x11, 0x11,
+  0xF8, 0xC1, 0x11, 0xC1, 0x11, 0x21, 0x13, 0x11,
+  0x2F, 0x7B, 0x1F, 0x01, 0x11, 0x11, 0x13, 0x21,
+  0x2F, 0x6D, 0x11, 0x11, 0x11, 0x12, 0x17, 0x11,
+  0x11, 0x11, 0x31, 0x12, 0xF6, 0xFF, 0x11, 0x11,
+  0x12, 0x11, 0x21, 0x1F, 0x4E, 0x11, 0x19, 0x17,
+  0x11, 0x41, 0x13, 0xF3, 0xFA, 0x1A, 0x11, 0x12,
+  0x11, 0x21, 0xF3, 0xF0, 0x11, 0x18, 0x11, 0x1A,
+  0x11, 0x14, 0xF2, 0x64, 0x41, 0x21, 0xF6, 0x13,
+  0x11, 0x12, 0xF0, 0x93, 0x61, 0xA1, 0x11, 0xA1,
+  0x11, 0x11, 0x3E, 0x73, 0xF7, 0x1A, 0x11, 0x11,
+  0x12, 0xE8, 0x4C, 0x31, 0x1F, 0x11, 0x11, 0x2D,
+  0x71, 0x12, 0xB1, 0x11, 0x22, 0x11, 0xE1, 0x11,
+  0x3D, 0xA1, 0x91, 0x13, 0x16, 0xE1, 0x11, 0x3C,
+  0xF5, 0x11, 0x21, 0x5F, 0x21, 0x4B, 0xF6, 0x12,
+  0x21, 0x31, 0x1F, 0x21, 0x3B, 0xF7, 0x11, 0x11,
+  0x11, 0x1F, 0x41, 0x4B, 0xFC, 0x1F, 0x51, 0x4B,
+  0x71, 0x11, 0x11, 0xFF, 0xBB, 0x51, 0x11, 0x11,
+  0x12, 0xFF, 0xAA, 0x69, 0xFF, 0xA9, 0x6A, 0xFF,
+  0x9A, 0x59, 0xFF, 0xA9, 0x6A, 0xFF, 0x31, 0x68,
+  0x68, 0xFF, 0x61, 0x58, 0x75, 0x11, 0x11, 0xFF,
+  0x41, 0x58, 0x52, 0x15, 0x11, 0xFF, 0x31, 0x78,
+  0x51, 0x11, 0x11, 0x13, 0x11, 0x11, 0xFF, 0x01,
+  0x11, 0x11, 0x47, 0x65, 0x11, 0x11, 0x41, 0xFC,
+  0x19, 0x86, 0x71, 0x11, 0x14, 0x11, 0x1F, 0x91,
+  0x11, 0x11, 0x46, 0x61, 0x17, 0x41, 0x11, 0x11,
+  0xF8, 0x19, 0x86, 0x11, 0x81, 0x51, 0x1F, 0x81,
+  0x11, 0x11, 0x57, 0x71, 0x11, 0x11, 0x14, 0x11,
+  0x21, 0xF9, 0x15, 0x14, 0x79, 0x11, 0x13, 0x11,
+  0x11, 0x11, 0x1F, 0xB1, 0x11, 0x21, 0x47, 0x71,
+  0x11, 0x11, 0x11, 0x31, 0xFA, 0x11, 0x12, 0x11,
+  0x16, 0x7F, 0xFF, 0x11, 0x41, 0x11, 0x37, 0xFF,
+  0xC1, 0x11, 0x21, 0x11, 0x78, 0xFF, 0xD1, 0x21,
+  0x11, 0x11, 0x11, 0x38, 0xFF, 0xA1, 0x31, 0x21,
+  0x87, 0xFF, 0xB1, 0x11, 0x21, 0x11, 0x11, 0x11,
+  0x48, 0xFF, 0xD1, 0x21, 0x98, 0xFF, 0xB1, 0x21,
+  0x21, 0x87, 0xFF, 0xB1, 0x21, 0x21, 0x97, 0xFF,
+  0xF0, 0x1B, 0x8F, 0xB1, 0xFE, 0x7F, 0x31, 0x11,
+  0x11, 0x11, 0x21, 0xF0, 0x1D, 0x7B, 0x11, 0x11,
+  0x11, 0x17, 0x1F, 0xF1, 0x7F, 0x31, 0x11, 0x11,
+  0xFF, 0x47, 0xD1, 0x11, 0x31, 0xFF, 0x77, 0xF1,
+  0x1F, 0xFA, 0x10,
 };
 
-// 64x64 1-bit pepe.png
-const uint8_t PEPE_ROM[BITMAP_BYTES] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x7F, 0xF8, 0x00, 0x40, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0xFE, 0x05, 0xF8, 0x00, 0x00,
-  0x00, 0x01, 0xFF, 0xD6, 0x0F, 0xFE, 0x00, 0x00,
-  0x00, 0x03, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-  0x00, 0x07, 0xE0, 0xFF, 0x0F, 0xE0, 0x00, 0x00,
-  0x00, 0x0F, 0x8F, 0xFF, 0xF1, 0xFF, 0xF0, 0x00,
-  0x00, 0x1F, 0x3F, 0xFF, 0x00, 0xFF, 0xF8, 0x00,
-  0x00, 0x3F, 0xFF, 0x80, 0xFC, 0x3E, 0x00, 0x00,
-  0x00, 0x3F, 0xFE, 0x00, 0x7E, 0x00, 0xFF, 0xF0,
-  0x00, 0x7F, 0xF8, 0x07, 0xFF, 0x00, 0x1F, 0x98,
-  0x00, 0x7F, 0xF8, 0x3F, 0xFF, 0x87, 0xFF, 0xF0,
-  0x00, 0x7F, 0xF0, 0xFF, 0x87, 0xCF, 0xF8, 0xF8,
-  0x00, 0x7F, 0xCF, 0xFF, 0x03, 0xEF, 0xF0, 0x7C,
-  0x00, 0xFF, 0xDF, 0xFE, 0x03, 0xEF, 0xE0, 0x3C,
-  0x00, 0xFF, 0xCF, 0xFE, 0x01, 0xE7, 0xE0, 0x3C,
-  0x00, 0xFF, 0xC7, 0xFE, 0x31, 0xE7, 0xE0, 0x3C,
-  0x00, 0xFF, 0xF3, 0xFC, 0x39, 0xE7, 0xE3, 0x3C,
-  0x03, 0xFF, 0xF9, 0xFE, 0x31, 0xE7, 0xE2, 0x3C,
-  0x07, 0xFF, 0xF8, 0xFE, 0x03, 0xE7, 0xF0, 0x7C,
-  0x0F, 0xFF, 0xF8, 0x7F, 0x07, 0xE1, 0xFF, 0xFC,
-  0x0F, 0xFF, 0xFC, 0x1F, 0xFF, 0xC4, 0x7F, 0xF8,
-  0x1F, 0xFF, 0xFE, 0x07, 0xFF, 0x83, 0x03, 0xC0,
-  0x1F, 0xFF, 0xFF, 0x00, 0x7C, 0x19, 0x0F, 0xF0,
-  0x3F, 0xFF, 0xFF, 0xE3, 0xFE, 0x3C, 0xF0, 0x00,
-  0x3F, 0xFF, 0xF1, 0xF8, 0x50, 0x7E, 0x7C, 0x00,
-  0x3F, 0xFF, 0xF8, 0x3F, 0x01, 0xFE, 0x00, 0x00,
-  0x3F, 0xFF, 0xFD, 0x02, 0x03, 0xFF, 0x05, 0x40,
-  0x3F, 0xFF, 0xFF, 0x80, 0x5F, 0xFF, 0x9F, 0xE0,
-  0x3F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xE0,
-  0x3F, 0xEE, 0x3F, 0xFF, 0xFF, 0xFF, 0xDF, 0xF0,
-  0x3F, 0xC8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-  0x3F, 0xD9, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-  0x3F, 0xF3, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xC8,
-  0x3F, 0xF3, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0x3C,
-  0x3F, 0xF3, 0x87, 0xF8, 0x0F, 0xFF, 0xE0, 0xF8,
-  0x3F, 0xF9, 0x80, 0xFF, 0x80, 0x00, 0x07, 0xC0,
-  0x3F, 0xFC, 0xC4, 0x1F, 0xFF, 0xFC, 0x00, 0x00,
-  0x3F, 0xFC, 0xC7, 0x40, 0xFF, 0xFE, 0x00, 0x00,
-  0x3F, 0xFF, 0x71, 0xE0, 0x00, 0x00, 0x70, 0x80,
-  0x3F, 0xFF, 0x30, 0x60, 0x00, 0x01, 0xF9, 0xC0,
-  0x1F, 0xFF, 0x9C, 0x00, 0x1F, 0xA1, 0xFC, 0xE0,
-  0x1F, 0xFF, 0xCF, 0x0C, 0x0F, 0xF9, 0xFE, 0x60,
-  0x0F, 0xFF, 0xE3, 0x9F, 0x83, 0xF8, 0xFF, 0x30,
-  0x07, 0xFF, 0xF1, 0xE7, 0xE1, 0xF8, 0xFF, 0x30,
-  0x03, 0xFF, 0xFC, 0xF0, 0xF8, 0x51, 0xFE, 0x70,
-  0x01, 0xFF, 0xFE, 0x3C, 0x1C, 0x03, 0xF0, 0xE0,
-  0x00, 0x7F, 0xFF, 0x87, 0x80, 0x07, 0x03, 0xC0,
-  0x00, 0x3F, 0xFF, 0xC1, 0xFF, 0xFE, 0x07, 0x00,
-  0x00, 0x0F, 0xFF, 0xF0, 0x7F, 0xF8, 0x0E, 0x00,
-  0x00, 0x07, 0xFF, 0xFE, 0x0F, 0x83, 0xFE, 0x00,
-  0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x3F, 0xFE, 0x00,
-  0x00, 0x00, 0x7F, 0xFF, 0xFB, 0x7F, 0xF8, 0x00,
-  0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-  0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-  0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 64x64 1-bit pepe.png, 287 bytes run-length encoded
+const uint8_t PEPE_ROM[] PROGMEM = {
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x66, 0xFF, 0xFA, 0xCC, 0x1F, 0xF8, 0xF0,
+  0x61, 0x16, 0xFF, 0x4B, 0x11, 0x12, 0x5B, 0xFF,
+  0x18, 0xDB, 0xFF, 0x16, 0x58, 0x47, 0xFF, 0x35,
+  0x3F, 0x13, 0xDF, 0x85, 0x2E, 0x8D, 0xF6, 0xF0,
+  0x76, 0x45, 0xFC, 0xDA, 0x69, 0xCD, 0xC8, 0xBB,
+  0x62, 0x2C, 0xC5, 0xF0, 0x4F, 0x0D, 0xB4, 0x94,
+  0x52, 0x93, 0x5C, 0x92, 0xC6, 0x51, 0x85, 0x5A,
+  0xA1, 0xC7, 0x51, 0x77, 0x4A, 0xA2, 0xB8, 0x42,
+  0x67, 0x4A, 0xA3, 0xA3, 0x23, 0x42, 0x67, 0x4A,
+  0xC2, 0x84, 0x32, 0x42, 0x63, 0x22, 0x48, 0xF0,
+  0x28, 0x32, 0x34, 0x26, 0x31, 0x34, 0x7F, 0x13,
+  0x77, 0x52, 0x75, 0x56, 0xF2, 0x47, 0x56, 0x4F,
+  0x06, 0xF3, 0x5F, 0x03, 0x13, 0xC6, 0xF5, 0x6C,
+  0x52, 0x64, 0x9F, 0x69, 0x55, 0x22, 0x14, 0x86,
+  0xFA, 0x39, 0x34, 0x24, 0xEF, 0x33, 0x64, 0x11,
+  0x15, 0x62, 0x5C, 0xF4, 0x56, 0x78, 0xF4, 0xF5,
+  0x11, 0x61, 0x7A, 0x51, 0x11, 0x11, 0x8F, 0x88,
+  0x11, 0xE2, 0x87, 0xA1, 0xFF, 0x62, 0x87, 0x91,
+  0x33, 0xFF, 0x21, 0x96, 0x82, 0x17, 0xFF, 0xA6,
+  0x81, 0x22, 0x44, 0xFF, 0x76, 0xA2, 0x85, 0xFF,
+  0x12, 0x15, 0xA2, 0xB6, 0xFA, 0x24, 0x4A, 0x23,
+  0x48, 0x7F, 0x05, 0x55, 0xB2, 0x27, 0x9F, 0x55,
+  0x8C, 0x22, 0x31, 0x5F, 0x4F, 0x5C, 0x22, 0x33,
+  0x11, 0x6F, 0x0F, 0x4E, 0x13, 0x34, 0xF7, 0x34,
+  0x19, 0xE2, 0x25, 0x2F, 0x56, 0x23, 0x9E, 0x23,
+  0xD6, 0x11, 0x47, 0x23, 0x8F, 0x02, 0x44, 0x26,
+  0x92, 0x82, 0x29, 0xF0, 0x33, 0x26, 0x57, 0x38,
+  0x22, 0x9F, 0x03, 0x42, 0x64, 0x63, 0x82, 0x2A,
+  0xF1, 0x24, 0x45, 0x41, 0x11, 0x38, 0x23, 0xBF,
+  0x13, 0x45, 0x38, 0x64, 0x3E, 0xF1, 0x44, 0xC3,
+  0x64, 0xF1, 0xF1, 0x5F, 0x16, 0x3F, 0x5F, 0x15,
+  0xC7, 0x3F, 0x7F, 0x35, 0x55, 0x9F, 0x9F, 0x48,
+  0xDF, 0xBF, 0x51, 0x21, 0xCF, 0xF0, 0xFF, 0x2F,
+  0xF3, 0xFE, 0xFF, 0x8F, 0x6F, 0xFF, 0xB1, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x90,
 };
 
-// 64x64 1-bit reee.png
-const uint8_t REEE_ROM[BITMAP_BYTES] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0F, 0xF8, 0x00, 0x14, 0x00, 0x00,
-  0x00, 0x00, 0x0F, 0xFE, 0x01, 0xFF, 0x80, 0x00,
-  0x00, 0x00, 0x7F, 0xFF, 0x8F, 0xFF, 0x80, 0x00,
-  0x00, 0x00, 0x7F, 0xFF, 0xCF, 0xFF, 0xE0, 0x00,
-  0x00, 0x00, 0xFF, 0x01, 0xDF, 0xFF, 0xE0, 0x00,
-  0x00, 0x00, 0xFE, 0x7E, 0x67, 0xFF, 0xF0, 0x00,
-  0x00, 0x03, 0xF1, 0xFF, 0x97, 0xD0, 0x20, 0x00,
-  0x00, 0x03, 0xEF, 0xFF, 0xC4, 0x00, 0x00, 0x00,
-  0x00, 0x07, 0xDF, 0xFF, 0xE7, 0xFF, 0x50, 0x00,
-  0x00, 0x03, 0xFF, 0xFE, 0xA7, 0xFF, 0xFC, 0x00,
-  0x00, 0x0F, 0xFF, 0xF0, 0xA7, 0xFF, 0xF8, 0x00,
-  0x00, 0x07, 0xFF, 0xE7, 0x53, 0xFF, 0xE0, 0x00,
-  0x00, 0x0F, 0xFF, 0x08, 0x21, 0xFF, 0x01, 0x00,
-  0x00, 0x6F, 0xFF, 0x00, 0x58, 0xFD, 0x17, 0x00,
-  0x01, 0xDF, 0xE0, 0x00, 0x00, 0x68, 0x38, 0xF0,
-  0x01, 0xEF, 0xF0, 0x07, 0xF0, 0x00, 0xD3, 0xFC,
-  0x03, 0xDF, 0xE4, 0x3F, 0xFC, 0x31, 0x1F, 0xFE,
-  0x03, 0xFF, 0xFE, 0xFF, 0xFE, 0x00, 0xFF, 0xCE,
-  0x07, 0xFF, 0xF9, 0xFF, 0xE7, 0x8F, 0xFF, 0xDE,
-  0x07, 0xFF, 0xFD, 0xFF, 0xF7, 0x9F, 0xFF, 0xC8,
-  0x0F, 0xFF, 0xFD, 0x7F, 0xE6, 0x07, 0xFF, 0x00,
-  0x0D, 0x7F, 0xFF, 0x8F, 0xE1, 0x0D, 0x55, 0xE0,
-  0x1C, 0x7F, 0xFE, 0xF4, 0x1E, 0x1F, 0xFF, 0xC0,
-  0x1C, 0x3F, 0xFF, 0x0F, 0xFC, 0x3F, 0xFF, 0x00,
-  0x18, 0x7F, 0xFF, 0xF0, 0x00, 0xE1, 0x50, 0x00,
-  0x18, 0xBF, 0xFF, 0xFF, 0x80, 0x7E, 0x1E, 0x00,
-  0x33, 0xFF, 0xEA, 0xF8, 0x03, 0xFF, 0x7E, 0x00,
-  0x3F, 0xFF, 0x8A, 0x08, 0xF3, 0xFF, 0xFC, 0x80,
-  0x7F, 0xFE, 0x7F, 0xE8, 0x2F, 0xFF, 0x83, 0x80,
-  0x3F, 0xFD, 0x7F, 0xFF, 0xC0, 0x00, 0x5F, 0x80,
-  0x7F, 0xFB, 0xE8, 0x2F, 0xFF, 0xFF, 0xFE, 0x00,
-  0x7F, 0xFB, 0xA1, 0x02, 0xFF, 0xFF, 0xEA, 0x00,
-  0x7F, 0xE6, 0x14, 0x50, 0x8A, 0xA8, 0x00, 0x00,
-  0x7F, 0xF7, 0x02, 0x14, 0x42, 0x00, 0x00, 0x00,
-  0x7F, 0xCC, 0x51, 0x41, 0x10, 0x00, 0x00, 0x00,
-  0x7F, 0xCD, 0x08, 0x28, 0x95, 0x00, 0x00, 0xA0,
-  0x7C, 0x38, 0x45, 0x05, 0x00, 0x00, 0x01, 0xF8,
-  0x7C, 0x1A, 0x20, 0xA5, 0xF8, 0x00, 0x05, 0x0E,
-  0x78, 0x34, 0x8A, 0x17, 0x6D, 0x00, 0x08, 0x04,
-  0x3F, 0xB8, 0x40, 0x95, 0x2D, 0xA0, 0xB0, 0x00,
-  0x7F, 0xB2, 0x2A, 0x3A, 0x01, 0x7F, 0x40, 0x00,
-  0x3F, 0xB9, 0x01, 0x59, 0x50, 0x0A, 0x00, 0x00,
-  0x3F, 0x72, 0x54, 0x70, 0x00, 0x00, 0x00, 0x00,
-  0x1F, 0xBA, 0x01, 0x35, 0x50, 0x00, 0x00, 0x00,
-  0x3F, 0xB0, 0xAA, 0xE8, 0x00, 0x00, 0x00, 0x00,
-  0x1F, 0xBA, 0x00, 0x25, 0x50, 0x00, 0x00, 0x00,
-  0x0F, 0xBC, 0xAA, 0xD0, 0x00, 0x00, 0x00, 0x00,
-  0x0F, 0xCE, 0xAF, 0xFF, 0x90, 0x00, 0x00, 0x00,
-  0x07, 0xDF, 0xFE, 0xBF, 0x68, 0x0A, 0xA0, 0x00,
-  0x31, 0xE3, 0xE8, 0x05, 0xFF, 0xFF, 0xF0, 0x00,
-  0xFC, 0x78, 0x0F, 0xD0, 0x55, 0x54, 0x00, 0x00,
-  0xFF, 0x0F, 0xFF, 0x9C, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0xF1, 0xFF, 0x08, 0xFF, 0xE0, 0x00, 0x00,
-  0xFF, 0xFF, 0xFF, 0x45, 0xFD, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0xFC, 0xFB, 0xE1, 0x00, 0x00, 0x76,
-  0xFF, 0xFF, 0xFB, 0xF9, 0xFF, 0xC0, 0x00, 0x7C,
-  0xFF, 0xFF, 0xC7, 0xFB, 0xFF, 0xE0, 0x03, 0xFE,
-  0xFF, 0xFF, 0x9F, 0xFC, 0xFF, 0xF8, 0x0B, 0xFF,
-  0xFF, 0xFC, 0x7F, 0xC1, 0xFF, 0xFC, 0x2F, 0xF4,
-  0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFE, 0x7F, 0xF0,
-  0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x7F, 0xC0,
-  0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x3F, 0xC0,
+// 64x64 1-bit reee.png, 439 bytes run-length encoded
+const uint8_t REEE_ROM[] PROGMEM = {
+  0xFF, 0xFF, 0xFC, 0x11, 0x1F, 0xFF, 0xD9, 0xE1,
+  0x11, 0xFF, 0x8B, 0x8A, 0xFF, 0x2F, 0x13, 0xDF,
+  0xF2, 0xF2, 0x2F, 0x0F, 0xE8, 0x73, 0x1F, 0x1F,
+  0xE7, 0x26, 0x22, 0x2F, 0x0F, 0xB6, 0x3A, 0x21,
+  0x15, 0x11, 0x61, 0xFC, 0x51, 0xE3, 0x1F, 0xF9,
+  0x51, 0xF1, 0x2B, 0x11, 0x11, 0xFB, 0xF2, 0x11,
+  0x11, 0x2F, 0x2F, 0x7F, 0x14, 0x11, 0x12, 0xF1,
+  0xF9, 0xE2, 0x31, 0x11, 0x12, 0xDF, 0xAC, 0x41,
+  0x51, 0x49, 0x71, 0xF2, 0x21, 0xC9, 0x11, 0x23,
+  0x61, 0x13, 0x11, 0x3F, 0x03, 0x18, 0xF7, 0x21,
+  0x15, 0x33, 0x4B, 0x41, 0x89, 0x7C, 0x21, 0x12,
+  0x88, 0x41, 0x82, 0x14, 0xC4, 0x23, 0x13, 0xC7,
+  0xF2, 0x1F, 0x09, 0xA2, 0x36, 0xF1, 0x2C, 0x24,
+  0x3E, 0x14, 0x6F, 0x21, 0xD1, 0x42, 0xF0, 0x21,
+  0x7F, 0x31, 0x11, 0xA2, 0x26, 0xBC, 0x21, 0x11,
+  0xF1, 0x37, 0x41, 0x42, 0x11, 0x11, 0x11, 0x11,
+  0x14, 0x83, 0x3E, 0x14, 0x11, 0x54, 0x4F, 0x09,
+  0x34, 0xE4, 0xA4, 0xEB, 0x24, 0xF4, 0xC3, 0x41,
+  0x11, 0x11, 0xF0, 0x23, 0x11, 0xF8, 0x86, 0x44,
+  0xB2, 0x2D, 0x11, 0x11, 0x15, 0x9A, 0x16, 0xBF,
+  0x03, 0x11, 0x15, 0x13, 0x42, 0xF1, 0x21, 0x8E,
+  0x2A, 0x11, 0x51, 0x1D, 0x53, 0x9C, 0x11, 0x1F,
+  0x2F, 0x01, 0x16, 0x8C, 0x15, 0x11, 0x51, 0x1F,
+  0xCA, 0xC1, 0x31, 0x14, 0x16, 0x11, 0xF4, 0x11,
+  0x11, 0xAA, 0x22, 0x41, 0x11, 0x31, 0x11, 0x41,
+  0x31, 0x11, 0x11, 0x11, 0x11, 0xF5, 0xB1, 0x36,
+  0x14, 0x11, 0x13, 0x14, 0x1F, 0xB9, 0x22, 0x31,
+  0x11, 0x31, 0x11, 0x51, 0x31, 0xFE, 0x92, 0x21,
+  0x14, 0x15, 0x11, 0x13, 0x12, 0x11, 0x11, 0x1F,
+  0x11, 0x11, 0x65, 0x43, 0x41, 0x31, 0x11, 0x51,
+  0x11, 0xF8, 0x64, 0x55, 0x21, 0x13, 0x15, 0x11,
+  0x12, 0x11, 0x6F, 0x11, 0x11, 0x43, 0x24, 0x52,
+  0x11, 0x21, 0x31, 0x11, 0x41, 0x13, 0x12, 0x12,
+  0x11, 0xC1, 0x81, 0x47, 0x13, 0x41, 0x61, 0x21,
+  0x11, 0x11, 0x21, 0x12, 0x12, 0x11, 0x51, 0x12,
+  0xD8, 0x12, 0x21, 0x31, 0x11, 0x11, 0x33, 0x11,
+  0x81, 0x17, 0x11, 0xF1, 0x71, 0x32, 0x17, 0x11,
+  0x11, 0x22, 0x11, 0x11, 0x18, 0x11, 0x1F, 0x46,
+  0x13, 0x21, 0x21, 0x11, 0x11, 0x33, 0xFF, 0x96,
+  0x13, 0x11, 0x81, 0x22, 0x11, 0x11, 0x11, 0x11,
+  0xFF, 0x07, 0x12, 0x41, 0x11, 0x11, 0x11, 0x13,
+  0x11, 0xFF, 0x86, 0x13, 0x11, 0xB1, 0x21, 0x11,
+  0x11, 0x11, 0xFF, 0x25, 0x14, 0x21, 0x11, 0x11,
+  0x11, 0x12, 0x11, 0xFF, 0xA6, 0x23, 0x11, 0x11,
+  0x1D, 0x21, 0xFF, 0x35, 0x1C, 0x11, 0x16, 0x12,
+  0x11, 0x71, 0x11, 0x11, 0x11, 0xF0, 0x23, 0x43,
+  0x51, 0x18, 0x11, 0xF6, 0xC6, 0x34, 0x76, 0x11,
+  0x51, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xF3,
+  0x84, 0xD2, 0x3F, 0xF4, 0xC3, 0x94, 0x13, 0xBF,
+  0x6F, 0x91, 0x13, 0x11, 0x71, 0x1F, 0x9F, 0x72,
+  0x51, 0x54, 0x1F, 0x23, 0x12, 0x1F, 0x61, 0x72,
+  0xBF, 0x05, 0x2F, 0x33, 0x81, 0xDB, 0x91, 0xF2,
+  0x2B, 0x2D, 0x71, 0x1F, 0x93, 0x95, 0xF0, 0x41,
+  0x18, 0x11, 0x2F, 0xB2, 0xF4, 0x2B, 0x4F, 0x92,
+  0xF7, 0x19, 0x6F, 0x91, 0xF8, 0x28, 0x60,
 };
 
-// 64x64 1-bit wojak.png
-const uint8_t WOJAK_ROM[BITMAP_BYTES] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-  0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-  0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-  0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-  0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-  0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-  0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-  0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-  0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-  0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-  0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-  0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x7E, 0xFC, 0x00,
-  0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x81, 0x3E, 0x00,
-  0x00, 0x1F, 0xFF, 0xFF, 0xE3, 0xFF, 0xDE, 0x00,
-  0x00, 0x1F, 0xFF, 0xFE, 0x1C, 0x7F, 0xFE, 0x00,
-  0x00, 0x3F, 0xFF, 0xD1, 0xFF, 0x80, 0x3E, 0x00,
-  0x00, 0x3F, 0xFF, 0x5F, 0xFF, 0xFF, 0xFE, 0x00,
-  0x00, 0x3F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x00,
-  0x00, 0x3F, 0xFF, 0xF8, 0x47, 0xFC, 0x0F, 0x00,
-  0x00, 0x3F, 0xFF, 0xE7, 0xFF, 0xFF, 0xF7, 0x80,
-  0x00, 0x3F, 0xFF, 0xFF, 0xFB, 0xFF, 0xFB, 0x80,
-  0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0x80,
-  0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x80,
-  0x00, 0x3F, 0xFF, 0xFC, 0x3F, 0xFD, 0xFF, 0x80,
-  0x00, 0x3F, 0xFF, 0xF8, 0x0F, 0xFF, 0xE7, 0x80,
-  0x00, 0x3F, 0xFF, 0xF3, 0x87, 0xFF, 0x03, 0x80,
-  0x00, 0x3F, 0xFF, 0xF9, 0x03, 0xFE, 0x63, 0x80,
-  0x00, 0x1F, 0xFF, 0xFC, 0x07, 0xFE, 0x03, 0x80,
-  0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0x80,
-  0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-  0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xC0,
-  0x00, 0x0F, 0xF7, 0xFF, 0xFF, 0xF9, 0xFF, 0xC0,
-  0x00, 0x07, 0xF7, 0xFF, 0xFF, 0xF9, 0xFF, 0xC0,
-  0x00, 0x07, 0xF7, 0xFF, 0xFF, 0xFD, 0xFF, 0xC0,
-  0x00, 0x03, 0xF7, 0xFF, 0xFF, 0xFE, 0x7F, 0xC0,
-  0x00, 0x01, 0xF7, 0xFF, 0xFF, 0xFF, 0x7F, 0xC0,
-  0x00, 0x01, 0xF7, 0xFF, 0xF8, 0xFF, 0x3F, 0x80,
-  0x00, 0x01, 0xFB, 0xFF, 0xFB, 0xFF, 0x7F, 0x80,
-  0x00, 0x00, 0xFB, 0xFF, 0xFB, 0xFE, 0x7F, 0x80,
-  0x00, 0x00, 0xFB, 0xFF, 0xF8, 0x9A, 0xFF, 0x00,
-  0x00, 0x01, 0xF9, 0xFF, 0xFE, 0xFC, 0xFF, 0x00,
-  0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-  0x00, 0x01, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-  0x00, 0x00, 0xFA, 0x7F, 0xFF, 0xFF, 0xFC, 0x00,
-  0x00, 0x01, 0xFD, 0xBF, 0xF3, 0xFF, 0xF8, 0x00,
-  0x00, 0x00, 0xFD, 0x9F, 0xF0, 0x00, 0x78, 0x00,
-  0x00, 0x01, 0xFD, 0xEF, 0xFF, 0xFF, 0x78, 0x00,
-  0x00, 0x01, 0xFD, 0xF3, 0xFF, 0xFF, 0xF8, 0x00,
-  0x00, 0x01, 0xFB, 0xF9, 0xFF, 0xFF, 0xF0, 0x00,
-  0x00, 0x03, 0xFF, 0xFC, 0xFF, 0xFF, 0xE0, 0x00,
-  0x00, 0x03, 0xFF, 0xFE, 0x7F, 0xFF, 0xC0, 0x00,
-  0x00, 0x03, 0xFF, 0xFF, 0x3F, 0xFF, 0xC0, 0x00,
-  0x00, 0x03, 0xFF, 0xFF, 0x8F, 0xFF, 0x00, 0x00,
-  0x00, 0x07, 0xFB, 0xFF, 0xE3, 0xFC, 0x00, 0x00,
-  0x00, 0x07, 0xE3, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-  0x00, 0x0F, 0xCF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-  0x00, 0x1F, 0xDF, 0xFF, 0xFB, 0xE0, 0x00, 0x00,
-  0x00, 0x3F, 0x9F, 0xFF, 0xF9, 0xE0, 0x00, 0x00,
-  0x00, 0x1F, 0x3F, 0xFF, 0xFD, 0xF8, 0x00, 0x00,
-  0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+// 64x64 1-bit wojak.png, 244 bytes run-length encoded
+const uint8_t WOJAK_ROM[] PROGMEM = {
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x0F, 0xFF,
+  0x2F, 0x5F, 0xFC, 0xF9, 0xFF, 0x8F, 0xCF, 0xF5,
+  0xFF, 0x0F, 0xF3, 0xFF, 0x3F, 0xF0, 0xFF, 0x5F,
+  0xEF, 0xF6, 0xFC, 0xFF, 0x8F, 0xBF, 0xF9, 0xFA,
+  0xFF, 0xAF, 0x8F, 0xFB, 0xF7, 0xFF, 0xDF, 0x6F,
+  0x2D, 0x61, 0x6F, 0x6F, 0xF0, 0x61, 0x25, 0xF5,
+  0xF9, 0x3C, 0x14, 0xF5, 0xF5, 0x43, 0x3E, 0xF4,
+  0xF1, 0x11, 0x3A, 0x95, 0xF4, 0xE1, 0x11, 0xFD,
+  0xF4, 0xF8, 0x1F, 0x7F, 0x3F, 0x44, 0x13, 0x96,
+  0x4F, 0x3F, 0x22, 0xF8, 0x14, 0xF2, 0xFC, 0x1F,
+  0x01, 0x3F, 0x2F, 0xD1, 0x71, 0xAF, 0x2F, 0xF6,
+  0x1A, 0xF2, 0xF5, 0x4C, 0x1A, 0xF2, 0xF4, 0x7F,
+  0x02, 0x4F, 0x2F, 0x32, 0x34, 0xB6, 0x3F, 0x2F,
+  0x42, 0x16, 0x92, 0x23, 0x3F, 0x3F, 0x47, 0xA7,
+  0x3F, 0x3F, 0xF9, 0x43, 0xF4, 0xFF, 0xF1, 0xF3,
+  0xFF, 0x31, 0xCF, 0x38, 0x1F, 0x92, 0xBF, 0x47,
+  0x1F, 0x92, 0xBF, 0x47, 0x1F, 0xA1, 0xBF, 0x56,
+  0x1F, 0xB2, 0x9F, 0x65, 0x1F, 0xC1, 0x9F, 0x65,
+  0x1F, 0x13, 0x82, 0x7F, 0x76, 0x1F, 0x01, 0xA1,
+  0x8F, 0x85, 0x1F, 0x01, 0x92, 0x8F, 0x85, 0x1F,
+  0x03, 0x12, 0x21, 0x11, 0x8F, 0x86, 0x2F, 0x11,
+  0x62, 0x8F, 0x96, 0x2F, 0xF1, 0xF9, 0x81, 0xFF,
+  0x0F, 0xB5, 0x11, 0x2F, 0xEF, 0xA7, 0x12, 0x1A,
+  0x2F, 0x0F, 0xC6, 0x12, 0x29, 0xD4, 0xFB, 0x71,
+  0x41, 0xF5, 0x14, 0xFB, 0x71, 0x52, 0xF8, 0xFB,
+  0x61, 0x72, 0xF6, 0xFB, 0xF1, 0x2F, 0x4F, 0xCF,
+  0x22, 0xF2, 0xFD, 0xF3, 0x2F, 0x1F, 0xDF, 0x43,
+  0xCF, 0xE8, 0x1D, 0x38, 0xFF, 0x16, 0x3F, 0x0F,
+  0xF9, 0x62, 0xF8, 0xFF, 0x27, 0x1F, 0x31, 0x5F,
+  0xF1, 0x72, 0xF3, 0x24, 0xFF, 0x25, 0x2F, 0x51,
+  0x6F, 0xAF, 0xFF, 0x58,
 };
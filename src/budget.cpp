@@ -0,0 +1,58 @@
+// Copyright (c) 2022 Trevor Makes
+
+#include "main.hpp"
+
+// Frame governor: times each call to the idle function against the frame
+// period for a target refresh rate, and raises the level of detail to shed
+// when a frame runs over. Long lines are traced in strides of 2^level steps
+// and dwell on lines and bitmap pixels is divided by 2^level, so each level
+// roughly halves the cost of a frame. The level drops again once a frame fits
+// in half the budget. Off by default.
+
+constexpr uint8_t MAX_DETAIL_LEVEL = 3;
+constexpr uint8_t MIN_BUDGET_HZ = 16; // Longest period that fits in 16 bits
+
+uint8_t g_detail_level = 0;
+static uint16_t g_budget_hz = 0; // Zero if the governor is off
+static uint16_t g_budget_us;
+static uint16_t g_frame_us; // Time taken by the last frame
+
+static void govern(uint16_t elapsed) {
+  g_frame_us = elapsed;
+  if (elapsed > g_budget_us) {
+    if (g_detail_level < MAX_DETAIL_LEVEL) ++g_detail_level;
+  } else if (elapsed < g_budget_us / 2) {
+    if (g_detail_level > 0) --g_detail_level;
+  }
+}
+
+void budget_idle() {
+  if (g_idle_fn == nullptr) return;
+  if (g_budget_hz == 0) {
+    g_idle_fn();
+    DAC::flush();
+    return;
+  }
+  auto start = micros();
+  g_idle_fn();
+  DAC::flush();
+  auto elapsed = micros() - start;
+  govern(elapsed > 0xFFFF ? 0xFFFF : elapsed);
+}
+
+// budget [hz], 0 to turn off
+void set_budget(Args args) {
+  if (args.has_next()) {
+    uint16_t hz = atoi(args.next());
+    if (hz != 0 && hz < MIN_BUDGET_HZ) hz = MIN_BUDGET_HZ;
+    g_budget_hz = hz;
+    g_budget_us = hz ? 1000000UL / hz : 0;
+    g_detail_level = 0;
+  }
+  g_serial_ex.print(F("budget: "));
+  g_serial_ex.print(g_budget_hz);
+  g_serial_ex.print(F(" Hz, frame: "));
+  g_serial_ex.print(g_frame_us);
+  g_serial_ex.print(F(" us, level: "));
+  g_serial_ex.println(g_detail_level);
+}
@@ -0,0 +1,132 @@
+// Copyright (c) 2022 Trevor Makes
+
+#include "main.hpp"
+#include "trig.hpp"
+
+// Curves traced as short chords with integer forward differencing: after a
+// few multiplies to set up, each step costs only additions, and the number of
+// steps grows with the size of the curve so small curves stay cheap.
+
+constexpr uint8_t CHORD_LENGTH = 4; // Target DAC steps per chord
+constexpr uint8_t MAX_SHIFT = 6; // Up to 64 chords per curve
+
+// Power of 2 steps giving chords of about CHORD_LENGTH over a curve whose
+// control polygon spans `length` DAC steps
+static uint8_t step_shift(uint16_t length) {
+  uint8_t shift = 0;
+  while (shift < MAX_SHIFT && (uint16_t(CHORD_LENGTH) << shift) < length) ++shift;
+  return shift;
+}
+
+static uint8_t span(int8_t a, int8_t b) {
+  return a < b ? b - a : a - b;
+}
+
+// Cubic polynomial a*t^3 + b*t^2 + c*t + d in one axis, stepped over 2^shift
+// equal intervals of t in [0, 1]. Values are scaled by 2^(3*shift).
+struct Stepper {
+  int32_t f, d1, d2, d3;
+  uint8_t shift;
+
+  void init(int16_t a, int16_t b, int16_t c, int8_t d, uint8_t s) {
+    shift = s * 3;
+    f = int32_t(d) << shift;
+    d1 = a + (int32_t(b) << s) + (int32_t(c) << (s * 2));
+    d2 = int32_t(a) * 6 + (int32_t(b) << (s + 1));
+    d3 = int32_t(a) * 6;
+  }
+
+  int8_t next() {
+    f += d1;
+    d1 += d2;
+    d2 += d3;
+    return (f + (int32_t(1) << shift >> 1)) >> shift;
+  }
+};
+
+static void trace(Stepper& x, Stepper& y, int8_t x0, int8_t y0, uint8_t shift) {
+  for (uint8_t i = uint8_t(1 << shift); i > 0; --i) {
+    int8_t x1 = x.next();
+    int8_t y1 = y.next();
+    draw_line(x0, y0, x1, y1);
+    x0 = x1;
+    y0 = y1;
+  }
+}
+
+void draw_quad_bezier(int8_t x0, int8_t y0, int8_t x1, int8_t y1, int8_t x2, int8_t y2) {
+  uint8_t shift = step_shift(
+    uint16_t(span(x0, x1)) + span(y0, y1) + span(x1, x2) + span(y1, y2));
+  Stepper x, y;
+  x.init(0, x0 - 2 * x1 + x2, 2 * (x1 - x0), x0, shift);
+  y.init(0, y0 - 2 * y1 + y2, 2 * (y1 - y0), y0, shift);
+  trace(x, y, x0, y0, shift);
+}
+
+void draw_cubic_bezier(int8_t x0, int8_t y0, int8_t x1, int8_t y1,
+    int8_t x2, int8_t y2, int8_t x3, int8_t y3) {
+  uint8_t shift = step_shift(uint16_t(span(x0, x1)) + span(y0, y1)
+    + span(x1, x2) + span(y1, y2) + span(x2, x3) + span(y2, y3));
+  Stepper x, y;
+  x.init(3 * (x1 - x2) + x3 - x0, 3 * (x0 - 2 * x1 + x2), 3 * (x1 - x0), x0, shift);
+  y.init(3 * (y1 - y2) + y3 - y0, 3 * (y0 - 2 * y1 + y2), 3 * (y1 - y0), y0, shift);
+  trace(x, y, x0, y0, shift);
+}
+
+// Round 8.8 to the nearest integer without overflowing int16
+static int8_t round8(int16_t value) {
+  return ((value >> 7) + 1) >> 1;
+}
+
+void draw_arc(int8_t xm, int8_t ym, int8_t r, uint8_t from, uint8_t to) {
+  // Minsky's circle algorithm rotates by about e = 2^-shift radians per step
+  // using only shifts and adds. Splitting the update to y into two half steps
+  // around the update to x keeps the path within a fraction of a step of a
+  // true circle, where plain Minsky traces an ellipse skewed by up to r*e/2.
+  if (r <= 0) return;
+  uint8_t shift = 2;
+  while (shift < 7 && (r >> shift) >= CHORD_LENGTH) ++shift;
+  uint16_t sweep = uint8_t(to - from);
+  if (sweep == 0) sweep = 256;
+  // Steps to cover the sweep, which is in 1/256 turns (2pi/256 ~= 201/8192)
+  uint16_t steps = (uint32_t(sweep) * 201 << shift) >> 13;
+
+  // Position relative to the center in 8.8
+  int16_t x = cos8(from) * r;
+  int16_t y = sin8(from) * r;
+  int16_t x0 = xm + round8(x);
+  int16_t y0 = ym + round8(y);
+  for (; steps > 0; --steps) {
+    y += x >> (shift + 1);
+    x -= y >> shift;
+    y += x >> (shift + 1);
+    int16_t x1 = xm + round8(x);
+    int16_t y1 = ym + round8(y);
+    draw_line(x0, y0, x1, y1);
+    x0 = x1;
+    y0 = y1;
+  }
+  // Land exactly on the end angle
+  draw_line(x0, y0, xm + round8(cos8(to) * r), ym + round8(sin8(to) * r));
+}
+
+void curves_idle() {
+  constexpr int8_t MAX_X = DAC::X::RESOLUTION - 1;
+  constexpr int8_t CENTER_X = DAC::X::RESOLUTION / 2;
+  constexpr int8_t CENTER_Y = DAC::Y::RESOLUTION / 2;
+  static uint8_t phase = 0;
+  // Three ribbons waving out of step, inside a pair of orbiting arcs
+  for (uint8_t i = 0; i < 3; ++i) {
+    int8_t y = CENTER_Y - 12 + i * 12;
+    int8_t a = sin8(phase + i * 32) >> 4;
+    int8_t b = cos8(phase * 2 + i * 48) >> 4;
+    draw_cubic_bezier(4, y, 21, y + a, 42, y - b, MAX_X - 4, y);
+  }
+  draw_arc(CENTER_X, CENTER_Y, 30, phase, phase + 96);
+  draw_arc(CENTER_X, CENTER_Y, 30, phase + 128, phase + 224);
+  phase += 2;
+}
+
+IdleFn init_curves() {
+  return curves_idle;
+}
@@ -0,0 +1,213 @@
+// Copyright (c) 2022 Trevor Makes
+
+#include "main.hpp"
+#include "trig.hpp"
+
+#if !defined(NATIVE)
+
+// Direct digital synthesis: a Timer1 ISR steps a phase accumulator for each
+// channel and writes the wavetable sample at that phase to the DAC, turning
+// the board into a two channel signal generator. The top 8 bits of each 24-bit
+// accumulator index a 256 sample table, so frequency resolution is
+// DDS_SAMPLE_HZ / 2^24 (about 2.4 mHz at the default 40 kHz).
+
+// Sample rate in Hz; the ISR takes roughly 130 cycles, so keep well below
+// F_CPU / 130 to leave time for the CLI
+#ifndef DDS_SAMPLE_HZ
+#define DDS_SAMPLE_HZ 40000
+#endif
+
+constexpr uint16_t DDS_TABLE_SIZE = 256;
+
+enum Wave : uint8_t { WAVE_SINE, WAVE_TRIANGLE, WAVE_SAW, WAVE_SQUARE, WAVE_LOADED };
+
+struct Channel {
+  Wave wave;
+  uint16_t hz;
+  uint8_t phase; // Offset in 1/256 turns when the channels are started
+};
+
+// X leads Y by a quarter turn, tracing a circle on an XY scope
+static Channel g_channels[2] = {
+  { WAVE_SINE, 100, 64 },
+  { WAVE_SINE, 100, 0 },
+};
+
+// Wavetables for X then Y, borrowed from span memory
+static uint8_t* g_dds_table;
+static volatile __uint24 g_phase_x, g_phase_y;
+static __uint24 g_step_x, g_step_y;
+
+// Phase step per sample for a frequency in Hz, in 1/2^24 turns
+static __uint24 phase_step(uint16_t hz) {
+  constexpr uint32_t SCALE = (1ULL << 40) / DDS_SAMPLE_HZ; // 2^24 / Fs in 16.16
+  return uint32_t(hz) * (SCALE >> 16) + ((uint32_t(hz) * (SCALE & 0xFFFF)) >> 16);
+}
+
+static void fill_wave(uint8_t* table, Wave wave) {
+  constexpr uint8_t RESOLUTION = DAC::X::RESOLUTION;
+  for (uint16_t i = 0; i < DDS_TABLE_SIZE; ++i) {
+    switch (wave) {
+      case WAVE_SINE:
+        table[i] = (uint16_t(sin8(i) + 256) * (RESOLUTION - 1) + 256) >> 9;
+        break;
+      case WAVE_TRIANGLE:
+        table[i] = (i < 128 ? i : 255 - i) * RESOLUTION / 128;
+        break;
+      case WAVE_SAW:
+        table[i] = i * RESOLUTION / DDS_TABLE_SIZE;
+        break;
+      default:
+        table[i] = i < 128 ? RESOLUTION - 1 : 0;
+        break;
+    }
+  }
+}
+
+// Scale `count` uploaded bytes to the DAC range and stretch them over the
+// whole table with linear interpolation. Working down from the end only
+// reads samples that haven't been overwritten yet.
+static void stretch_wave(uint8_t* table, uint16_t count) {
+  constexpr uint8_t RESOLUTION = DAC::X::RESOLUTION;
+  for (uint16_t i = DDS_TABLE_SIZE; i-- > 0; ) {
+    uint16_t pos = i * count; // Sample position in 1/256ths
+    uint8_t j = pos >> 8;
+    uint8_t t = pos & 0xFF;
+    uint8_t a = table[j];
+    uint8_t b = table[j + 1 < count ? j + 1 : 0];
+    uint8_t sample = (uint16_t(a) * (256 - t) + uint16_t(b) * t) >> 8;
+    table[i] = sample * RESOLUTION / 256;
+  }
+}
+
+void dds_idle() {
+  // Output happens in the ISR; the display is off while it runs
+}
+
+ISR(TIMER1_COMPA_vect) {
+  // Write first so that sample timing doesn't depend on the code below
+  PortDAC::X::write(g_dds_table[uint8_t(g_phase_x >> 16)]);
+  PortDAC::Y::write(g_dds_table[DDS_TABLE_SIZE + uint8_t(g_phase_y >> 16)]);
+  g_phase_x += g_step_x;
+  g_phase_y += g_step_y;
+
+  // Stop once another mode is selected
+  if (g_idle_fn != dds_idle) {
+    TIMSK1 = 0;
+  }
+}
+
+// Span memory is needed elsewhere, so the tables are about to be overwritten
+static void dds_release() {
+  TIMSK1 = 0;
+  g_dds_table = nullptr;
+}
+
+static bool dds_running() {
+  return TIMSK1 & _BV(OCIE1A);
+}
+
+static void dds_begin() {
+  TIMSK1 = 0;
+  g_step_x = phase_step(g_channels[0].hz);
+  g_step_y = phase_step(g_channels[1].hz);
+  g_phase_x = __uint24(g_channels[0].phase) << 16;
+  g_phase_y = __uint24(g_channels[1].phase) << 16;
+  g_idle_fn = dds_idle;
+
+  // Timer1 in CTC mode without prescaler, interrupt on compare match
+  TCCR1A = 0;
+  TCCR1B = _BV(WGM12) | _BV(CS10);
+  OCR1A = F_CPU / DDS_SAMPLE_HZ - 1;
+  TCNT1 = 0;
+  TIMSK1 = _BV(OCIE1A);
+}
+
+// dds [x|y [sine|tri|saw|square|load] [hz] [phase]]
+void dds_command(Args args) {
+  // Check the channel before taking span memory from whoever holds it
+  uint8_t index = 0;
+  bool set_channel = args.has_next();
+  if (set_channel) {
+    const char* name = args.next();
+    if (strcmp_P(name, PSTR("y")) == 0) {
+      index = 1;
+    } else if (strcmp_P(name, PSTR("x")) != 0) {
+      g_serial_ex.println(F("dds [x|y [sine|tri|saw|square|load] [hz] [phase]]"));
+      return;
+    }
+  }
+
+  uint8_t* tables = borrow_scratch(dds_release);
+  if (tables == nullptr) {
+    g_serial_ex.println(F("turn off gray first"));
+    return;
+  }
+
+  // Loaded waves only survive while the output keeps running
+  bool running = dds_running();
+  for (Channel& channel : g_channels) {
+    if (channel.wave == WAVE_LOADED && !running) channel.wave = WAVE_SINE;
+  }
+
+  if (set_channel) {
+    Channel& channel = g_channels[index];
+    uint8_t* table = tables + index * DDS_TABLE_SIZE;
+
+    const char* wave = args.next();
+    if (strcmp_P(wave, PSTR("sine")) == 0) {
+      channel.wave = WAVE_SINE;
+    } else if (strcmp_P(wave, PSTR("tri")) == 0) {
+      channel.wave = WAVE_TRIANGLE;
+    } else if (strcmp_P(wave, PSTR("saw")) == 0) {
+      channel.wave = WAVE_SAW;
+    } else if (strcmp_P(wave, PSTR("square")) == 0) {
+      channel.wave = WAVE_SQUARE;
+    } else if (strcmp_P(wave, PSTR("load")) == 0) {
+      // Read up to 256 samples as IHX, keeping the other channel running and
+      // the display from using span memory meanwhile
+      IdleFn prev_idle_fn = g_idle_fn;
+      g_idle_fn = dds_idle;
+      uint16_t count;
+      uint8_t errors = read_ihx(table, DDS_TABLE_SIZE, count);
+      if (errors != 0 || count < 2) {
+        if (errors == IHX_CANCELLED) {
+          g_serial_ex.println(F("load cancelled"));
+        } else if (errors == IHX_TIMED_OUT) {
+          g_serial_ex.println(F("load timed out"));
+        } else {
+          g_serial_ex.println(F("bad wave"));
+        }
+        fill_wave(table, channel.wave == WAVE_LOADED ? WAVE_SINE : channel.wave);
+        if (channel.wave == WAVE_LOADED) channel.wave = WAVE_SINE;
+        g_idle_fn = prev_idle_fn;
+        return;
+      }
+      stretch_wave(table, count);
+      channel.wave = WAVE_LOADED;
+    } else if (wave[0] != '\0') {
+      g_serial_ex.println(F("unknown wave"));
+      return;
+    }
+    if (args.has_next()) {
+      uint32_t hz = atol(args.next());
+      if (hz > DDS_SAMPLE_HZ / 2) {
+        g_serial_ex.print(F("max Hz: "));
+        g_serial_ex.println(DDS_SAMPLE_HZ / 2);
+        return;
+      }
+      channel.hz = hz;
+    }
+    channel.phase = args.has_next() ? atoi(args.next()) : 0;
+  }
+
+  for (uint8_t i = 0; i < 2; ++i) {
+    if (g_channels[i].wave != WAVE_LOADED) {
+      fill_wave(tables + i * DDS_TABLE_SIZE, g_channels[i].wave);
+    }
+  }
+  g_dds_table = tables;
+  dds_begin();
+}
+
+#endif
@@ -0,0 +1,226 @@
+// Copyright (c) 2022 Trevor Makes
+
+#include "main.hpp"
+
+// Retained display list: shapes added from the CLI are packed into a byte
+// buffer and traced every frame by dlist_idle, so screens can be built up
+// over the serial connection without reflashing. Each entry starts with its
+// type, followed by signed coordinates:
+//   DL_LINE x0 y0 x1 y1
+//   DL_CIRCLE x y r
+//   DL_POLY n x0 y0 ... xn-1 yn-1
+//   DL_ARC x y r from to
+//   DL_QUAD x0 y0 x1 y1 x2 y2
+//   DL_CUBIC x0 y0 x1 y1 x2 y2 x3 y3
+
+enum : uint8_t { DL_LINE, DL_CIRCLE, DL_POLY, DL_ARC, DL_QUAD, DL_CUBIC };
+
+constexpr uint8_t DL_BYTES = 128;
+
+// The list is kept in span memory, so it is lost when the bitmap or another
+// mode takes that memory back
+static int8_t* g_dl = nullptr;
+static uint8_t g_dl_size = 0;
+
+static void release_dl() {
+  g_dl = nullptr;
+  g_dl_size = 0;
+}
+
+// Borrow span memory for the list if not already held, or print an error
+// and return false
+static bool dl_borrow() {
+  if (g_dl == nullptr) {
+    g_dl = reinterpret_cast<int8_t*>(borrow_scratch(release_dl));
+    if (g_dl == nullptr) {
+      g_serial_ex.println(F("turn off gray first"));
+      return false;
+    }
+  }
+  return true;
+}
+
+static uint8_t entry_size(const int8_t* entry) {
+  switch (entry[0]) {
+    case DL_LINE: return 5;
+    case DL_CIRCLE: return 4;
+    case DL_ARC: return 6;
+    case DL_QUAD: return 7;
+    case DL_CUBIC: return 9;
+    default: return 2 + uint8_t(entry[1]) * 2;
+  }
+}
+
+void dlist_idle() {
+  const int8_t* entry = g_dl;
+  const int8_t* end = g_dl + g_dl_size;
+  while (entry < end) {
+    switch (entry[0]) {
+      case DL_LINE:
+        draw_line(entry[1], entry[2], entry[3], entry[4]);
+        break;
+      case DL_CIRCLE:
+        draw_circle(entry[1], entry[2], entry[3]);
+        break;
+      case DL_POLY: {
+        uint8_t n = entry[1];
+        const int8_t* p = entry + 2;
+        for (uint8_t i = 1; i < n; ++i, p += 2) {
+          draw_line(p[0], p[1], p[2], p[3]);
+        }
+        break;
+      }
+      case DL_ARC:
+        draw_arc(entry[1], entry[2], entry[3], entry[4], entry[5]);
+        break;
+      case DL_QUAD:
+        draw_quad_bezier(entry[1], entry[2], entry[3], entry[4], entry[5], entry[6]);
+        break;
+      case DL_CUBIC:
+        draw_cubic_bezier(entry[1], entry[2], entry[3], entry[4],
+          entry[5], entry[6], entry[7], entry[8]);
+        break;
+    }
+    entry += entry_size(entry);
+  }
+}
+
+// Reserve room for an entry of the given size, or print an error and return
+// nullptr if the list is full
+static int8_t* dl_append(uint8_t size) {
+  if (!dl_borrow()) return nullptr;
+  if (g_dl_size + size > DL_BYTES) {
+    g_serial_ex.println(F("display list full"));
+    return nullptr;
+  }
+  int8_t* entry = g_dl + g_dl_size;
+  g_dl_size += size;
+  g_idle_fn = dlist_idle;
+  return entry;
+}
+
+// Read `count` numeric arguments, or print usage and return false
+static bool read_args(Args& args, int8_t* values, uint8_t count, const __FlashStringHelper* usage) {
+  for (uint8_t i = 0; i < count; ++i) {
+    if (!args.has_next()) {
+      g_serial_ex.println(usage);
+      return false;
+    }
+    values[i] = atoi(args.next());
+  }
+  return true;
+}
+
+// line x0 y0 x1 y1
+void dl_line(Args args) {
+  int8_t values[4];
+  if (!read_args(args, values, 4, F("line x0 y0 x1 y1"))) return;
+  int8_t* entry = dl_append(5);
+  if (entry == nullptr) return;
+  entry[0] = DL_LINE;
+  memcpy(entry + 1, values, 4);
+}
+
+// circ x y r
+void dl_circle(Args args) {
+  int8_t values[3];
+  if (!read_args(args, values, 3, F("circ x y r"))) return;
+  int8_t* entry = dl_append(4);
+  if (entry == nullptr) return;
+  entry[0] = DL_CIRCLE;
+  memcpy(entry + 1, values, 3);
+}
+
+// poly x0 y0 x1 y1 ...
+void dl_poly(Args args) {
+  // Collect points at the end of the list before committing the entry
+  if (!dl_borrow()) return;
+  int8_t* entry = g_dl + g_dl_size;
+  uint8_t n = 0;
+  while (args.has_next()) {
+    int8_t point[2];
+    if (!read_args(args, point, 2, F("poly x0 y0 x1 y1 ..."))) return;
+    if (g_dl_size + 2 + (n + 1) * 2 > DL_BYTES) {
+      g_serial_ex.println(F("display list full"));
+      return;
+    }
+    entry[2 + n * 2] = point[0];
+    entry[3 + n * 2] = point[1];
+    ++n;
+  }
+  if (n < 2) {
+    g_serial_ex.println(F("poly x0 y0 x1 y1 ..."));
+    return;
+  }
+  dl_append(2 + n * 2);
+  entry[0] = DL_POLY;
+  entry[1] = n;
+}
+
+// arc x y r from to, with angles in 1/256 turns counterclockwise from +X
+void dl_arc(Args args) {
+  int8_t values[5];
+  if (!read_args(args, values, 5, F("arc x y r from to"))) return;
+  int8_t* entry = dl_append(6);
+  if (entry == nullptr) return;
+  entry[0] = DL_ARC;
+  memcpy(entry + 1, values, 5);
+}
+
+// curve x0 y0 x1 y1 x2 y2 [x3 y3], quadratic or cubic Bezier
+void dl_curve(Args args) {
+  int8_t values[8];
+  if (!read_args(args, values, 6, F("curve x0 y0 x1 y1 x2 y2 [x3 y3]"))) return;
+  bool cubic = args.has_next();
+  if (cubic && !read_args(args, values + 6, 2, F("curve x0 y0 x1 y1 x2 y2 [x3 y3]"))) return;
+  uint8_t count = cubic ? 8 : 6;
+  int8_t* entry = dl_append(count + 1);
+  if (entry == nullptr) return;
+  entry[0] = cubic ? DL_CUBIC : DL_QUAD;
+  memcpy(entry + 1, values, count);
+}
+
+// Print an entry as the command that would add it
+static void print_entry(const int8_t* entry) {
+  const int8_t* arg = entry + 1;
+  switch (entry[0]) {
+    case DL_LINE: g_serial_ex.print(F("line")); break;
+    case DL_CIRCLE: g_serial_ex.print(F("circ")); break;
+    case DL_ARC: g_serial_ex.print(F("arc")); break;
+    case DL_QUAD:
+    case DL_CUBIC: g_serial_ex.print(F("curve")); break;
+    default: g_serial_ex.print(F("poly")); ++arg; break;
+  }
+  const int8_t* end = entry + entry_size(entry);
+  for (; arg < end; ++arg) {
+    g_serial_ex.print(F(" "));
+    // Arc angles run from 0 to 255
+    if (entry[0] == DL_ARC && arg >= entry + 4) {
+      g_serial_ex.print(uint8_t(*arg));
+    } else {
+      g_serial_ex.print(*arg);
+    }
+  }
+  g_serial_ex.println();
+}
+
+// dl [clear|undo]
+void dl_command(Args args) {
+  const char* cmd = args.next();
+  if (strcmp_P(cmd, PSTR("clear")) == 0) {
+    g_dl_size = 0;
+  } else if (strcmp_P(cmd, PSTR("undo")) == 0) {
+    // Walk to the start of the last entry
+    uint8_t last = 0;
+    for (uint8_t i = 0; i < g_dl_size; i += entry_size(g_dl + i)) {
+      last = i;
+    }
+    g_dl_size = last;
+  }
+  for (uint8_t i = 0; i < g_dl_size; i += entry_size(g_dl + i)) {
+    print_entry(g_dl + i);
+  }
+  g_serial_ex.print(F("bytes free: "));
+  g_serial_ex.println(DL_BYTES - g_dl_size);
+  g_idle_fn = dlist_idle;
+}
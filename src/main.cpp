@@ -11,6 +11,9 @@ IdleFn init_attract();
 void setup() {
   // Configure I/O ports for output
   DAC::config();
+#if defined(FRAME_MARKER)
+  DDRD |= _BV(FRAME_MARKER);
+#endif
 
   // Begin in attract mode
   g_idle_fn = init_attract();
@@ -20,6 +23,15 @@ void setup() {
   while (!Serial) {}
 }
 
+#if defined(FRAME_MARKER)
+// Toggle a spare pin on port D before each call to the idle function so a
+// simulator can time frames from the pin edges (see bench/simavr)
+void marked_idle() {
+  PORTD ^= _BV(FRAME_MARKER);
+  budget_idle();
+}
+#endif
+
 template <IdleFn (*Fn)()>
 void DoIdle(Args) {
   g_idle_fn = Fn();
@@ -38,23 +50,53 @@ void loop() {
     { F("cross"), do_cross },
     { F("bounce"), DoIdle<init_bounce> },
     { F("circum"), DoIdle<init_circum> },
+    { F("spin"), DoIdle<init_spin> },
     { F("lissajous"), custom_lissajous },
+    // wireframe.cpp
+    { F("cube"), DoIdle<init_cube> },
+    { F("ico"), DoIdle<init_ico> },
+    // curve.cpp
+    { F("curves"), DoIdle<init_curves> },
+    // vfont.cpp
+    { F("vlogo"), DoIdle<init_vlogo> },
+    { F("vprint"), vprint_message },
     // bitmap.cpp
     { F("doge"), DoIdle<init_doge> },
     { F("pepe"), DoIdle<init_pepe> },
     { F("reee"), DoIdle<init_reee> },
     { F("wojak"), DoIdle<init_wojak> },
+    { F("life"), DoIdle<init_life> },
     { F("fliph"), flip_horizontal },
     { F("flipv"), flip_vertical },
+    { F("scan"), set_scan_order },
+    { F("gray"), toggle_gray },
     { F("export"), export_bitmap },
     { F("import"), import_bitmap },
     { F("save"), save_bitmap },
     { F("load"), load_bitmap },
     { F("delay"), set_delay },
+    { F("settle"), set_settle },
+    // budget.cpp
+    { F("budget"), set_budget },
+    // stream.cpp
+    { F("stream"), stream_data },
+    // dds.cpp
+    { F("dds"), dds_command },
+    // dlist.cpp
+    { F("line"), dl_line },
+    { F("circ"), dl_circle },
+    { F("arc"), dl_arc },
+    { F("poly"), dl_poly },
+    { F("curve"), dl_curve },
+    { F("dl"), dl_command },
   };
 
   // Prompt for a command from the list while looping over the idle function
-  g_serial_cli.prompt(commands, g_idle_fn);
+#if defined(FRAME_MARKER)
+  g_serial_cli.prompt(commands, marked_idle);
+#else
+  g_serial_cli.prompt(commands, budget_idle);
+#endif
 }
 
 static uint8_t g_mode;
@@ -64,7 +106,7 @@ static decltype(millis()) g_lastMillis;
 void attract_idle() {
   using InitFn = IdleFn(*)();
   struct Entry { InitFn init_fn; uint16_t delay_ms; };
-  static const Entry entries[] = {
+  static const Entry entries[] PROGMEM = {
     { init_logo, 10000 },
     { init_maze, 15000 },
     { init_lj_11, 15000 },
@@ -72,7 +114,10 @@ void attract_idle() {
     { init_bounce, 15000 },
     { init_lj_12, 15000 },
     { init_pepe, 10000 },
+    { init_life, 10000 },
     { init_circum, 15000 },
+    { init_spin, 10000 },
+    { init_ico, 10000 },
     { init_lj_56, 15000 },
   };
   static const uint8_t N_ENTRIES = sizeof(entries) / sizeof(Entry);
@@ -87,8 +132,8 @@ void attract_idle() {
   if (elapsed >= g_countdown) {
     const Entry& next = entries[g_mode];
     g_mode = (g_mode + 1) % N_ENTRIES;
-    g_countdown = next.delay_ms;
-    delegate = next.init_fn();
+    g_countdown = pgm_read_word(&next.delay_ms);
+    delegate = reinterpret_cast<InitFn>(pgm_read_ptr(&next.init_fn))();
   } else {
     g_countdown -= elapsed;
   }
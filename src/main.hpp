@@ -2,27 +2,68 @@
 
 #pragma once
 
-#include "core/arduino.hpp"
-#include "core/io.hpp"
-#include "core/cli.hpp"
+#if defined(NATIVE)
+  // Host build for benchmarks; provides stand-ins for the Arduino API and CLI
+  #include "native.hpp"
+#else
+  #include "core/arduino.hpp"
+  #include "core/io.hpp"
+  #include "core/cli.hpp"
+
+  using core::serial::StreamEx;
+  using core::cli::IdleFn;
+  using core::cli::Args;
+  using core::cli::Command;
+  using CLI = core::cli::CLI<32>; // Limit line buffer to 32 bytes
 
-using core::serial::StreamEx;
-using core::cli::IdleFn;
-using core::cli::Args;
-using core::cli::Command;
-using CLI = core::cli::CLI<20>; // Limit line buffer to 20 bytes
+  extern CLI g_serial_cli;
+#endif
 
 extern IdleFn g_idle_fn;
 extern StreamEx g_serial_ex;
-extern CLI g_serial_cli;
 
 void bitmap_idle();
+// Mirror bitmap rows and columns onto the DAC axes, as set by flipv and fliph
+extern bool g_flip_v;
+extern bool g_flip_h;
+uint8_t* borrow_scratch(void (*release)());
+void reclaim_scratch();
 void set_delay(Args);
+void set_settle(Args);
 
+// Level of detail shed by the frame governor to keep up the refresh rate,
+// from 0 for full detail (see budget.cpp)
+extern uint8_t g_detail_level;
+void budget_idle();
+void set_budget(Args);
+
+// Shapes are clipped to the screen; the _fast versions skip clipping and
+// must only be given shapes that are entirely on screen. draw_line takes
+// 16-bit endpoints so transformed points can be clipped before they wrap. Lines given a dwell
+// hold that many microseconds per step (more on diagonal steps, to keep the
+// beam speed even), making them brighter without tracing them again.
+void draw_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+void draw_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t dwell);
+void draw_line_fast(int8_t x0, int8_t y0, int8_t x1, int8_t y1);
+void draw_line_fast(int8_t x0, int8_t y0, int8_t x1, int8_t y1, uint8_t dwell);
+void draw_circle(int8_t xm, int8_t ym, int8_t r);
+void draw_circle_fast(int8_t xm, int8_t ym, int8_t r);
+void draw_arc(int8_t xm, int8_t ym, int8_t r, uint8_t from, uint8_t to);
+void draw_quad_bezier(int8_t x0, int8_t y0, int8_t x1, int8_t y1, int8_t x2, int8_t y2);
+void draw_cubic_bezier(int8_t x0, int8_t y0, int8_t x1, int8_t y1,
+  int8_t x2, int8_t y2, int8_t x3, int8_t y3);
+IdleFn init_curves();
+void draw_vchar(int8_t x, int8_t y, uint8_t scale, char c);
+void draw_vstring(int8_t x, int8_t y, uint8_t scale, const char* str);
+IdleFn init_vlogo();
+void vprint_message(Args);
 void do_circle(Args);
 void do_cross(Args);
 IdleFn init_bounce();
 IdleFn init_circum();
+IdleFn init_spin();
+IdleFn init_cube();
+IdleFn init_ico();
 void custom_lissajous(Args);
 IdleFn init_lj_11();
 IdleFn init_lj_12();
@@ -37,14 +78,61 @@ IdleFn init_doge();
 IdleFn init_pepe();
 IdleFn init_reee();
 IdleFn init_wojak();
+IdleFn init_life();
 void flip_vertical(Args);
 void flip_horizontal(Args);
+void set_scan_order(Args);
+bool spans_overflowed();
+void toggle_gray(Args);
 void export_bitmap(Args);
 void import_bitmap(Args);
+#if !defined(NATIVE)
+  constexpr uint8_t IHX_CANCELLED = 0xFF;
+  constexpr uint8_t IHX_TIMED_OUT = 0xFE;
+  uint8_t read_ihx(uint8_t* dest, uint16_t size, uint16_t& end);
+#endif
 void save_bitmap(Args);
 void load_bitmap(Args);
 
-#if defined(ARDUINO_AVR_UNO) || defined(ARDUINO_AVR_NANO)
+void stream_data(Args);
+void dds_command(Args);
+
+void dlist_idle();
+void dl_line(Args);
+void dl_circle(Args);
+void dl_arc(Args);
+void dl_poly(Args);
+void dl_curve(Args);
+void dl_command(Args);
+
+#if defined(NATIVE)
+  // For the host build, each write is handed to a sink implemented by the
+  // benchmark so the X/Y stream can be recorded instead of driving ports.
+  // Values are masked to 6 bits to match what the Uno/Nano DAC would see.
+  void dac_sink_x(uint8_t x);
+  void dac_sink_y(uint8_t y);
+  void dac_sink_hold(uint8_t us);
+
+  struct DAC {
+    struct X {
+      static constexpr uint8_t RESOLUTION = 64;
+      static void write(uint8_t x) { dac_sink_x(x & 0x3F); }
+    };
+
+    struct Y {
+      static constexpr uint8_t RESOLUTION = 64;
+      static void write(uint8_t y) { dac_sink_y(y & 0x3F); }
+    };
+
+    // Linger at the current position so the dot appears brighter
+    static void hold(uint8_t us) { dac_sink_hold(us); }
+
+    // Writes take effect immediately, so there is nothing to push
+    static void flush() {}
+
+    static void config() {}
+  };
+#elif defined(ARDUINO_AVR_UNO) || defined(ARDUINO_AVR_NANO)
   // For Uno/Nano boards, the two highest bits of ports B and C are unavailable
   // (used for oscillator and reset). The upper bits could be masked off using
   // `::Mask<0x3F>`, but not doing so significantly speeds up vector drawing.
@@ -58,7 +146,7 @@ void load_bitmap(Args);
   //  8RΩ - B2 |   ___   | x
   //  4RΩ - B3 |  |USB|  | x
   //  2RΩ - B4 |__|___|__| B5 -  1RΩ
-  struct DAC {
+  struct PortDAC {
   protected:
     CORE_PORT(B)
     CORE_PORT(C)
@@ -72,11 +160,25 @@ void load_bitmap(Args);
       static constexpr uint8_t RESOLUTION = 64;
     };
 
+    // Linger at the current position so the dot appears brighter
+    static void hold(uint8_t us) { delayMicroseconds(us); }
+
+    // Writes take effect immediately, so there is nothing to push
+    static void flush() {}
+
     static void config() {
       X::config_output();
       Y::config_output();
     }
   };
+
+  #if defined(DAC_QUEUE)
+    // Points are queued and written to the ports by a timer ISR
+    #include "queue.hpp"
+    using DAC = QueuedDAC;
+  #else
+    using DAC = PortDAC;
+  #endif
 #else
   #error The I/O port mapping has not been defined for the target platform
 #endif
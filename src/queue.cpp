@@ -0,0 +1,41 @@
+// Copyright (c) 2022 Trevor Makes
+
+#include "main.hpp"
+
+#if defined(DAC_QUEUE)
+
+Sample g_queue[QUEUE_SIZE];
+volatile uint8_t g_queue_head = 0;
+volatile uint8_t g_queue_tail = 0;
+Sample g_pending;
+uint8_t g_pending_axes = 0;
+
+void queue_begin() {
+  // Timer2 in CTC mode with /8 prescaler (2 MHz), interrupt on compare match
+  TCCR2A = _BV(WGM21);
+  TCCR2B = _BV(CS21);
+  OCR2A = DAC_SAMPLE_US * 2 - 1;
+  TIMSK2 = _BV(OCIE2A);
+}
+
+ISR(TIMER2_COMPA_vect) {
+  static uint8_t dwell = 0;
+
+  // Keep holding the previous point
+  if (dwell > 0) {
+    --dwell;
+    return;
+  }
+
+  // Park on the last point if the renderer has fallen behind
+  uint8_t head = g_queue_head;
+  if (head == g_queue_tail) return;
+
+  const Sample& sample = g_queue[head];
+  PortDAC::X::write(sample.x);
+  PortDAC::Y::write(sample.y);
+  dwell = sample.dwell;
+  g_queue_head = (head + 1) & QUEUE_MASK;
+}
+
+#endif
@@ -0,0 +1,88 @@
+// Copyright (c) 2022 Trevor Makes
+
+#pragma once
+
+// Renderers push points into a ring buffer which the Timer2 ISR pops and
+// writes to the DAC ports at a fixed sample rate. A write to an axis that
+// was already written since the last point commits that point, so the X and
+// Y halves of a diagonal step are merged into a single sample. Frames are not
+// retained: the renderer waits while the queue is full, and the beam parks on
+// the last point once the queue runs dry.
+
+// Sample period in microseconds; Timer2 ticks at 2 MHz, so at most 127
+#ifndef DAC_SAMPLE_US
+#define DAC_SAMPLE_US 10
+#endif
+
+struct Sample {
+  uint8_t x;
+  uint8_t y;
+  uint8_t dwell; // Extra sample periods to hold the point
+};
+
+constexpr uint8_t QUEUE_SIZE = 32; // Must be a power of two
+constexpr uint8_t QUEUE_MASK = QUEUE_SIZE - 1;
+
+extern Sample g_queue[QUEUE_SIZE];
+extern volatile uint8_t g_queue_head; // Next index popped by ISR
+extern volatile uint8_t g_queue_tail; // Next index pushed by renderer
+
+// Point being assembled from individual axis writes
+extern Sample g_pending;
+extern uint8_t g_pending_axes;
+
+void queue_begin();
+
+struct QueuedDAC {
+  static constexpr uint8_t AXIS_X = 1;
+  static constexpr uint8_t AXIS_Y = 2;
+
+  // Wait for room in the queue and push the pending point
+  static void commit() {
+    uint8_t tail = g_queue_tail;
+    uint8_t next = (tail + 1) & QUEUE_MASK;
+    while (next == g_queue_head) {}
+    g_queue[tail] = g_pending;
+    // Finish storing the sample before the ISR can see it
+    asm volatile("" ::: "memory");
+    g_queue_tail = next;
+    g_pending.dwell = 0;
+    g_pending_axes = 0;
+  }
+
+  struct X {
+    static constexpr uint8_t RESOLUTION = PortDAC::X::RESOLUTION;
+    static void write(uint8_t x) {
+      if (g_pending_axes & AXIS_X) commit();
+      g_pending.x = x;
+      g_pending_axes |= AXIS_X;
+    }
+  };
+
+  struct Y {
+    static constexpr uint8_t RESOLUTION = PortDAC::Y::RESOLUTION;
+    static void write(uint8_t y) {
+      if (g_pending_axes & AXIS_Y) commit();
+      g_pending.y = y;
+      g_pending_axes |= AXIS_Y;
+    }
+  };
+
+  // Linger on the pending point, rounded to whole sample periods
+  static void hold(uint8_t us) {
+    uint16_t dwell = g_pending.dwell + (us + DAC_SAMPLE_US / 2) / DAC_SAMPLE_US;
+    g_pending.dwell = dwell > 0xFF ? 0xFF : dwell;
+    g_pending_axes = AXIS_X | AXIS_Y;
+  }
+
+  // Push the last point of a frame, which would otherwise wait for the next
+  // write to commit it
+  static void flush() {
+    if (g_pending_axes) commit();
+  }
+
+  static void config() {
+    PortDAC::config();
+    queue_begin();
+  }
+};
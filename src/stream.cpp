@@ -0,0 +1,207 @@
+// Copyright (c) 2022 Trevor Makes
+
+#include "main.hpp"
+
+// Binary streaming mode: the serial port switches to a high baud rate and the
+// host sends framed packets of vertices, which are queued in a ring and traced
+// as they arrive (see tools/stream.py). Packet layout:
+//   SYNC, type, payload length, payload, CRC-8 of type through payload
+// Types:
+//   'P' points, payload of x, y pairs each drawn as a dot
+//   'L' line strip, payload of x, y pairs joined by lines
+//   'F' end of frame; the vertices since the previous 'F' are traced
+//       repeatedly until the next frame is complete
+//   'Q' quit streaming mode and return to the CLI at 9600 baud
+// Coordinates run from 0 to 63; a packet with any coordinate out of range is
+// acknowledged but dropped. Streaming also ends if nothing is received for
+// STREAM_TIMEOUT_MS, so the CLI comes back if the host goes away.
+// Flow control is one packet in flight: the host may send one packet after
+// entering streaming mode and one more for every ACK. A packet with a bad CRC
+// is answered with NAK and should be resent. Packets are kept small enough to
+// fit the serial receive buffer, so bytes aren't dropped while drawing.
+
+constexpr uint8_t SYNC = 0xA5;
+constexpr uint8_t ACK = 0x06;
+constexpr uint8_t NAK = 0x15;
+constexpr uint8_t MAX_PAYLOAD = 58; // Whole packet fits the 64 byte RX buffer
+constexpr uint8_t MAX_VERTS = MAX_PAYLOAD / 2;
+constexpr uint16_t STREAM_TIMEOUT_MS = 5000;
+
+// Vertices are queued in span memory as x, y byte pairs, with the top bit of x
+// set if a line should be drawn from the previous vertex. The bitmap itself is
+// left alone.
+constexpr uint16_t RING_VERTS = DAC::X::RESOLUTION / 8 * DAC::Y::RESOLUTION / 2;
+constexpr uint16_t RING_MASK = RING_VERTS - 1;
+constexpr uint8_t LINE_FLAG = 0x80;
+static_assert((RING_VERTS & RING_MASK) == 0, "ring size must be a power of 2");
+
+static uint8_t* g_ring = nullptr;
+
+static void release_ring() {
+  g_ring = nullptr;
+}
+
+static uint16_t g_frame_start; // Frame being traced
+static uint16_t g_frame_end; // Start of the frame being received
+static uint16_t g_head; // End of the frame being received
+
+static uint16_t ring_free() {
+  return RING_VERTS - ((g_head - g_frame_start) & RING_MASK);
+}
+
+// Trace the vertices received since the last commit from now on
+static void commit_frame() {
+  g_frame_start = g_frame_end;
+  g_frame_end = g_head;
+}
+
+static uint8_t crc8_update(uint8_t crc, uint8_t data) {
+  // CRC-8 with polynomial x^8 + x^2 + x + 1, same as _crc8_ccitt_update
+  crc ^= data;
+  for (uint8_t i = 0; i < 8; ++i) {
+    crc = crc & 0x80 ? (crc << 1) ^ 0x07 : crc << 1;
+  }
+  return crc;
+}
+
+enum ParseState : uint8_t { WAIT_SYNC, READ_TYPE, READ_LEN, READ_PAYLOAD, READ_CRC };
+
+struct Parser {
+  ParseState state = WAIT_SYNC;
+  uint8_t type = 0;
+  uint8_t len = 0;
+  uint8_t index = 0;
+  uint8_t crc = 0;
+  bool in_range = true; // All coordinates in the payload are on screen
+};
+
+// Handle a packet with a valid CRC, whose payload is already staged at g_head.
+// Returns false when streaming should end.
+static bool apply_packet(uint8_t type, uint8_t len) {
+  uint8_t count = len / 2;
+  switch (type) {
+    case 'L':
+      // Join each vertex after the first to the one before
+      for (uint8_t i = 1; i < count; ++i) {
+        g_ring[((g_head + i) & RING_MASK) * 2] |= LINE_FLAG;
+      }
+      // fall through
+    case 'P':
+      g_head = (g_head + count) & RING_MASK;
+      break;
+    case 'F':
+      commit_frame();
+      break;
+    case 'Q':
+      return false;
+  }
+  return true;
+}
+
+// Feed one received byte to the parser, staging payload in the ring
+// Returns false when streaming should end.
+static bool parse_byte(Parser& p, uint8_t byte) {
+  switch (p.state) {
+    case WAIT_SYNC:
+      if (byte == SYNC) p.state = READ_TYPE;
+      break;
+    case READ_TYPE:
+      p.type = byte;
+      p.crc = crc8_update(0, byte);
+      p.state = READ_LEN;
+      break;
+    case READ_LEN:
+      if (byte > MAX_PAYLOAD || byte % 2 != 0) {
+        p.state = WAIT_SYNC;
+        break;
+      }
+      p.len = byte;
+      p.index = 0;
+      p.in_range = true;
+      p.crc = crc8_update(p.crc, byte);
+      p.state = byte ? READ_PAYLOAD : READ_CRC;
+      break;
+    case READ_PAYLOAD: {
+      if (byte >= DAC::X::RESOLUTION) p.in_range = false;
+      uint16_t vert = (g_head + p.index / 2) & RING_MASK;
+      g_ring[vert * 2 + p.index % 2] = p.index % 2 ? byte : byte & ~LINE_FLAG;
+      p.crc = crc8_update(p.crc, byte);
+      if (++p.index == p.len) p.state = READ_CRC;
+      break;
+    }
+    case READ_CRC:
+      p.state = WAIT_SYNC;
+      if (byte != p.crc) {
+        Serial.write(NAK);
+        break;
+      }
+      if (!p.in_range) {
+        Serial.write(ACK);
+        break;
+      }
+      if (!apply_packet(p.type, p.len)) {
+        Serial.write(ACK);
+        return false;
+      }
+      // Make room for the next packet, dropping frames that never ended
+      while (ring_free() <= MAX_VERTS) commit_frame();
+      Serial.write(ACK);
+      break;
+  }
+  return true;
+}
+
+void stream_data(Args args) {
+  uint32_t baud = args.has_next() ? atol(args.next()) : 1000000;
+  g_ring = borrow_scratch(release_ring);
+  if (g_ring == nullptr) {
+    g_serial_ex.println(F("turn off gray first"));
+    return;
+  }
+  g_serial_ex.print(F("streaming at "));
+  g_serial_ex.println(baud);
+  Serial.flush();
+  Serial.begin(baud);
+
+  g_frame_start = g_frame_end = g_head = 0;
+  uint16_t draw = 0;
+  uint8_t last_x = 0;
+  uint8_t last_y = 0;
+  Parser parser;
+  uint32_t last_rx = millis();
+  for (;;) {
+    // Drain the receive buffer before tracing the next vertex
+    bool streaming = true;
+    while (streaming && Serial.available() > 0) {
+      streaming = parse_byte(parser, Serial.read());
+      last_rx = millis();
+    }
+    if (!streaming || millis() - last_rx > STREAM_TIMEOUT_MS) break;
+
+    if (g_frame_start == g_frame_end) {
+      // Push the last point out while waiting for a frame
+      DAC::flush();
+      continue;
+    }
+    if (((draw - g_frame_start) & RING_MASK) >= ((g_frame_end - g_frame_start) & RING_MASK)) {
+      draw = g_frame_start;
+    }
+    uint8_t x = g_ring[draw * 2];
+    uint8_t y = g_ring[draw * 2 + 1];
+    if (x & LINE_FLAG) {
+      x &= ~LINE_FLAG;
+      draw_line(last_x, last_y, x, y);
+    } else {
+      DAC::X::write(x);
+      DAC::Y::write(y);
+    }
+    last_x = x;
+    last_y = y;
+    draw = (draw + 1) & RING_MASK;
+  }
+
+  DAC::flush();
+  Serial.flush();
+  Serial.begin(9600);
+  g_idle_fn = bitmap_idle;
+}
@@ -17,37 +17,48 @@ constexpr char FIRST_CHAR = '!';
 constexpr char LAST_CHAR = '~';
 
 extern uint8_t BITMAP_RAM[];
+extern uint8_t g_top_row;
+extern bool g_bitmap_dirty;
+extern bool g_gray;
+
+uint8_t* bitmap_row(uint8_t row);
+void scroll_bitmap(uint8_t rows);
+void mark_rows_dirty(uint8_t begin, uint8_t end);
 
 void draw_string(uint8_t row, const char* str) {
-  uint8_t* col_ptr = BITMAP_RAM + row * TEXT_COLS;
   uint8_t rows = core::util::min(ROWS_PER_CHAR, BITMAP_ROWS - core::util::min(BITMAP_ROWS, row));
+  mark_rows_dirty(row, row + rows);
+
+  // Rows may wrap around the ring, so fill in one pixel row at a time
+  for (uint8_t char_row = 0; char_row < rows; ++char_row) {
+    uint8_t* col_ptr = bitmap_row(row + char_row);
 
-  // Clear line
-  memset(col_ptr, 0, TEXT_COLS * rows);
+    // Clear line
+    memset(col_ptr, 0, TEXT_COLS);
 
-  for (uint8_t col = 0; col < TEXT_COLS; ++col) {
-    // Read ASCII code for current character
-    char c = *str++;
+    for (uint8_t col = 0; col < TEXT_COLS; ++col) {
+      // Read ASCII code for current character
+      char c = str[col];
 
-    // End early if we find end of string
-    if (c == '\0')
-      break;
+      // End early if we find end of string
+      if (c == '\0')
+        break;
 
-    // Skip non-printable characters
-    if (c < FIRST_CHAR || c > LAST_CHAR)
-      continue;
+      // Skip non-printable characters
+      if (c < FIRST_CHAR || c > LAST_CHAR)
+        continue;
 
-    // Trace each character fully before advancing to next character
-    uint16_t char_index = (c - FIRST_CHAR) * ROWS_PER_CHAR;
-    const uint8_t* char_ptr = &CHAR_ROM[char_index];
-    for (uint8_t offset = col; offset < TEXT_COLS * rows; offset += TEXT_COLS) {
-      col_ptr[offset] = pgm_read_byte(char_ptr++);
+      uint16_t char_index = (c - FIRST_CHAR) * ROWS_PER_CHAR + char_row;
+      col_ptr[col] = pgm_read_byte(&CHAR_ROM[char_index]);
     }
   }
 }
 
 void clear_bitmap() {
   memset(BITMAP_RAM, 0, TEXT_COLS * BITMAP_ROWS);
+  g_top_row = 0;
+  g_gray = false;
+  g_bitmap_dirty = true;
 }
 
 // Clear each row of screen buffer
@@ -72,7 +83,7 @@ void print_message(Args args) {
   const char* message = args.next();
 
   // Scroll rows up from the bottom
-  memmove(BITMAP_RAM, BITMAP_RAM + TEXT_COLS * ROWS_PER_CHAR, (TEXT_ROWS - 1) * TEXT_COLS * ROWS_PER_CHAR);
+  scroll_bitmap(ROWS_PER_CHAR);
 
   // Copy message into now vacant line at bottom
   draw_string((TEXT_ROWS - 1) * ROWS_PER_CHAR, message);
@@ -95,7 +106,7 @@ void maze_idle() {
       }
     }
     // Scroll line up by one pixel
-    memmove(BITMAP_RAM, BITMAP_RAM + TEXT_COLS, (BITMAP_ROWS - 1) * TEXT_COLS);
+    scroll_bitmap(1);
     draw_string(BITMAP_ROWS - g_scroll_count, maze_chars);
     if (g_scroll_count == ROWS_PER_CHAR) g_scroll_count = 0;
   }
@@ -0,0 +1,35 @@
+// Copyright (c) 2022 Trevor Makes
+
+#include "transform.hpp"
+
+void Transform::set(uint8_t angle, int16_t scale, int8_t tx, int8_t ty) {
+  int16_t c = (int32_t(cos8(angle)) * scale) >> 8;
+  int16_t s = (int32_t(sin8(angle)) * scale) >> 8;
+  xx = c;
+  xy = -s;
+  yx = s;
+  yy = c;
+  this->tx = tx;
+  this->ty = ty;
+}
+
+void draw_model(const Transform& transform, const int8_t* model) {
+  for (;;) {
+    uint8_t n = pgm_read_byte(model++);
+    if (n == 0) break;
+    // Transform each vertex once, drawing from the previous one
+    int8_t px = pgm_read_byte(model++);
+    int8_t py = pgm_read_byte(model++);
+    int16_t x0 = transform.x(px, py);
+    int16_t y0 = transform.y(px, py);
+    while (--n > 0) {
+      px = pgm_read_byte(model++);
+      py = pgm_read_byte(model++);
+      int16_t x1 = transform.x(px, py);
+      int16_t y1 = transform.y(px, py);
+      draw_line(x0, y0, x1, y1);
+      x0 = x1;
+      y0 = y1;
+    }
+  }
+}
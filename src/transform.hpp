@@ -0,0 +1,33 @@
+// Copyright (c) 2022 Trevor Makes
+
+#pragma once
+
+#include "main.hpp"
+#include "trig.hpp"
+
+// 2D affine transform in 8.8 fixed point, mapping model coordinates to DAC
+// coordinates: x' = (xx*x + xy*y) / 256 + tx, y' = (yx*x + yy*y) / 256 + ty.
+// Sine and cosine are looked up once in `set`, so each vertex costs four
+// multiplies.
+struct Transform {
+  int16_t xx, xy, yx, yy;
+  int8_t tx, ty;
+
+  // Rotate counterclockwise by `angle` (1/256 turns), scale by `scale` (8.8),
+  // then translate to (tx, ty)
+  void set(uint8_t angle, int16_t scale, int8_t tx, int8_t ty);
+
+  // Results may fall off screen, or outside int8_t, so are left to draw_line
+  // to clip
+  int16_t x(int8_t px, int8_t py) const {
+    return ((int32_t(xx) * px + int32_t(xy) * py + 128) >> 8) + tx;
+  }
+
+  int16_t y(int8_t px, int8_t py) const {
+    return ((int32_t(yx) * px + int32_t(yy) * py + 128) >> 8) + ty;
+  }
+};
+
+// Draw a model stored in program memory as a list of polylines, each a vertex
+// count followed by that many x, y pairs, ending with a count of 0
+void draw_model(const Transform& transform, const int8_t* model);
@@ -0,0 +1,47 @@
+// Copyright (c) 2022 Trevor Makes
+
+#include "trig.hpp"
+
+// Compute tables at compile time, stored in Flash memory
+#define SINE_STEP(i) uint16_t(sin((i) * M_PI / 128) * 256 + 0.5)
+#define SINE_STEP4(i) SINE_STEP(i), SINE_STEP(i + 1), SINE_STEP(i + 2), SINE_STEP(i + 3)
+#define SINE_STEP16(i) SINE_STEP4(i), SINE_STEP4(i + 4), SINE_STEP4(i + 8), SINE_STEP4(i + 12)
+const uint16_t SINE_LUT[65] PROGMEM = {
+  SINE_STEP16(0), SINE_STEP16(16), SINE_STEP16(32), SINE_STEP16(48), SINE_STEP(64),
+};
+#undef SINE_STEP16
+#undef SINE_STEP4
+#undef SINE_STEP
+
+// ATAN_LUT[i] = atan(i/64) in 8-bit binary radians, 0 to 32 (45 degrees)
+#define ATAN_STEP(i) uint8_t(atan((i) / 64.) * 128 / M_PI + 0.5)
+#define ATAN_STEP4(i) ATAN_STEP(i), ATAN_STEP(i + 1), ATAN_STEP(i + 2), ATAN_STEP(i + 3)
+#define ATAN_STEP16(i) ATAN_STEP4(i), ATAN_STEP4(i + 4), ATAN_STEP4(i + 8), ATAN_STEP4(i + 12)
+static const uint8_t ATAN_LUT[65] PROGMEM = {
+  ATAN_STEP16(0), ATAN_STEP16(16), ATAN_STEP16(32), ATAN_STEP16(48), ATAN_STEP(64),
+};
+#undef ATAN_STEP16
+#undef ATAN_STEP4
+#undef ATAN_STEP
+
+uint8_t atan2_8(int16_t y, int16_t x) {
+  if (x == 0 && y == 0) return 0;
+  // Reduce to the first octant, where the ratio of the sides is at most 1
+  uint16_t ax = x < 0 ? -x : x;
+  uint16_t ay = y < 0 ? -y : y;
+  // Drop precision the table can't use so the ratio fits 16-bit division
+  while ((ax | ay) >= 1024) {
+    ax >>= 1;
+    ay >>= 1;
+  }
+  uint8_t angle;
+  if (ax >= ay) {
+    angle = pgm_read_byte(&ATAN_LUT[(ay << 6) / ax]);
+  } else {
+    angle = 64 - pgm_read_byte(&ATAN_LUT[(ax << 6) / ay]);
+  }
+  // Mirror into the other quadrants
+  if (x < 0) angle = 128 - angle;
+  if (y < 0) angle = -angle;
+  return angle;
+}
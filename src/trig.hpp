@@ -0,0 +1,27 @@
+// Copyright (c) 2022 Trevor Makes
+
+#pragma once
+
+#include "main.hpp"
+
+// Fixed-point trigonometry for the vector modes. Angles are 8-bit binary
+// radians (256 steps per turn) and results are 8.8 fixed point, so 1.0 = 256.
+
+// Quarter-wave sine table: SINE_LUT[i] = sin(i/256 turn) * 256 for i in 0-64
+extern const uint16_t SINE_LUT[65] PROGMEM;
+
+inline int16_t sin8(uint8_t angle) {
+  // Second and fourth quadrants read the table backwards
+  uint8_t i = angle & 63;
+  if (angle & 64) i = 64 - i;
+  int16_t s = pgm_read_word(&SINE_LUT[i]);
+  // Third and fourth quadrants are negative
+  return angle & 128 ? -s : s;
+}
+
+inline int16_t cos8(uint8_t angle) {
+  return sin8(angle + 64);
+}
+
+// Angle of the vector (x, y), from 0 along +X counting towards +Y
+uint8_t atan2_8(int16_t y, int16_t x);
@@ -1,10 +1,44 @@
 // Copyright (c) 2022 Trevor Makes
 
 #include "main.hpp"
+#include "trig.hpp"
+#include "transform.hpp"
 
 #include "core/util.hpp"
 
-void draw_line(int8_t x0, int8_t y0, int8_t x1, int8_t y1) {
+// Lines at least this many steps long are decimated by the frame governor
+constexpr int8_t LOD_MIN_STEPS = 8;
+
+// Bresenham along the major axis in strides of 2^shift steps, catching up
+// along the minor axis between strides, and letting the beam sweep the gaps
+template <typename Major, typename Minor>
+static void draw_line_strided(int8_t a0, int8_t b0, int8_t a1, int8_t b1, uint8_t shift) {
+  int8_t da = a0 < a1 ? a1 - a0 : a0 - a1;
+  int8_t sa = a0 < a1 ? 1 << shift : -(1 << shift);
+  int8_t db = b0 < b1 ? b1 - b0 : b0 - b1;
+  int8_t sb = b0 < b1 ? 1 : -1;
+  int16_t step = int16_t(db) << shift;
+  int16_t error = da / 2;
+
+  Major::write(a0);
+  Minor::write(b0);
+  for (uint8_t n = da >> shift; n > 0; --n) {
+    a0 += sa;
+    error -= step;
+    while (error < 0) {
+      error += da;
+      b0 += sb;
+    }
+    Major::write(a0);
+    Minor::write(b0);
+  }
+  if (a0 != a1) {
+    Major::write(a1);
+    Minor::write(b1);
+  }
+}
+
+void draw_line_fast(int8_t x0, int8_t y0, int8_t x1, int8_t y1) {
   // https://en.wikipedia.org/wiki/Bresenham's_line_algorithm
   // https://rosettacode.org/wiki/Bitmap/Bresenham's_line_algorithm#C
   int8_t dx = x0 < x1 ? x1 - x0 : x0 - x1;
@@ -13,6 +47,15 @@ void draw_line(int8_t x0, int8_t y0, int8_t x1, int8_t y1) {
   int8_t sy = y0 < y1 ? 1 : -1;
   int8_t error = (dx > dy ? dx : -dy) / 2;
 
+  if (g_detail_level > 0 && (dx >= LOD_MIN_STEPS || dy >= LOD_MIN_STEPS)) {
+    if (dx >= dy) {
+      draw_line_strided<DAC::X, DAC::Y>(x0, y0, x1, y1, g_detail_level);
+    } else {
+      draw_line_strided<DAC::Y, DAC::X>(y0, x0, y1, x1, g_detail_level);
+    }
+    return;
+  }
+
   DAC::X::write(x0);
   DAC::Y::write(y0);
   while (x0 != x1 || y0 != y1) {
@@ -30,38 +73,150 @@ void draw_line(int8_t x0, int8_t y0, int8_t x1, int8_t y1) {
   }
 }
 
-template <uint8_t Q>
-void write_quad_x(int8_t xm, int8_t ym, int8_t x) {
+// Dwell per diagonal step relative to an axis step, sqrt(2) in 1.7 fixed point
+constexpr uint8_t DIAGONAL_DWELL = 181;
+
+void draw_line_fast(int8_t x0, int8_t y0, int8_t x1, int8_t y1, uint8_t dwell) {
+  dwell >>= g_detail_level;
+  if (dwell == 0) {
+    draw_line_fast(x0, y0, x1, y1);
+    return;
+  }
+  // Hold on every step for time in proportion to its length, so the beam
+  // moves at the same speed along lines of any slope
+  uint16_t diagonal = (uint16_t(dwell) * DIAGONAL_DWELL + 64) >> 7;
+  uint8_t diagonal_dwell = diagonal > 0xFF ? 0xFF : diagonal;
+  int8_t dx = x0 < x1 ? x1 - x0 : x0 - x1;
+  int8_t sx = x0 < x1 ? 1 : -1;
+  int8_t dy = y0 < y1 ? y1 - y0 : y0 - y1;
+  int8_t sy = y0 < y1 ? 1 : -1;
+  int8_t error = (dx > dy ? dx : -dy) / 2;
+
+  DAC::X::write(x0);
+  DAC::Y::write(y0);
+  DAC::hold(dwell);
+  while (x0 != x1 || y0 != y1) {
+    int8_t e2 = error;
+    uint8_t hold = dwell;
+    if (e2 > -dx) {
+      error -= dy;
+      x0 += sx;
+      DAC::X::write(x0);
+    }
+    if (e2 < dy) {
+      error += dx;
+      y0 += sy;
+      DAC::Y::write(y0);
+      if (e2 > -dx) hold = diagonal_dwell;
+    }
+    DAC::hold(hold);
+  }
+}
+
+// Cohen-Sutherland outcode bits for points off each side of the screen
+enum : uint8_t { CLIP_LEFT = 1, CLIP_RIGHT = 2, CLIP_BOTTOM = 4, CLIP_TOP = 8 };
+
+static uint8_t outcode(int16_t x, int16_t y) {
+  constexpr int16_t MAX_X = DAC::X::RESOLUTION - 1;
+  constexpr int16_t MAX_Y = DAC::Y::RESOLUTION - 1;
+  uint8_t code = 0;
+  if (x < 0) code |= CLIP_LEFT;
+  else if (x > MAX_X) code |= CLIP_RIGHT;
+  if (y < 0) code |= CLIP_BOTTOM;
+  else if (y > MAX_Y) code |= CLIP_TOP;
+  return code;
+}
+
+// Offset along one axis where the line through (0, 0) and (dx, dy) meets y,
+// rounded to the nearest step
+static int16_t intercept(int16_t dx, int16_t dy, int16_t y) {
+  int32_t num = int32_t(dx) * y * 2;
+  if (dy < 0) num = -num, dy = -dy;
+  return (num + (num < 0 ? -dy : dy)) / (dy * 2);
+}
+
+void draw_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+  draw_line(x0, y0, x1, y1, 0);
+}
+
+void draw_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t dwell) {
+  // https://en.wikipedia.org/wiki/Cohen%E2%80%93Sutherland_algorithm
+  constexpr int16_t MAX_X = DAC::X::RESOLUTION - 1;
+  constexpr int16_t MAX_Y = DAC::Y::RESOLUTION - 1;
+  uint8_t code0 = outcode(x0, y0);
+  uint8_t code1 = outcode(x1, y1);
+  if ((code0 | code1) == 0) {
+    draw_line_fast(x0, y0, x1, y1, dwell);
+    return;
+  }
+
+  // Move outside endpoints onto the edge they cross, until the line is
+  // either entirely on screen or entirely off one side
+  int16_t ax = x0, ay = y0, bx = x1, by = y1;
+  while ((code0 | code1) != 0) {
+    if ((code0 & code1) != 0) return;
+    uint8_t code = code0 ? code0 : code1;
+    int16_t x, y;
+    if (code & CLIP_TOP) {
+      y = MAX_Y;
+      x = ax + intercept(bx - ax, by - ay, y - ay);
+    } else if (code & CLIP_BOTTOM) {
+      y = 0;
+      x = ax + intercept(bx - ax, by - ay, y - ay);
+    } else if (code & CLIP_RIGHT) {
+      x = MAX_X;
+      y = ay + intercept(by - ay, bx - ax, x - ax);
+    } else {
+      x = 0;
+      y = ay + intercept(by - ay, bx - ax, x - ax);
+    }
+    if (code == code0) {
+      ax = x, ay = y;
+      code0 = outcode(x, y);
+    } else {
+      bx = x, by = y;
+      code1 = outcode(x, y);
+    }
+  }
+  draw_line_fast(ax, ay, bx, by, dwell);
+}
+
+static inline void write_x(int8_t x) { DAC::X::write(x); }
+static inline void write_y(int8_t y) { DAC::Y::write(y); }
+
+// Write only the axis that changed, for circles known to be on screen
+template <uint8_t Q, typename T>
+void write_quad_x(T xm, T ym, T x) {
   if (Q == 0) {
-    DAC::X::write(xm - x);
+    write_x(T(xm - x));
   } else if (Q == 1) {
-    DAC::Y::write(ym - x);
+    write_y(T(ym - x));
   } else if (Q == 2) {
-    DAC::X::write(xm + x);
+    write_x(T(xm + x));
   } else if (Q == 3) {
-    DAC::Y::write(ym + x);
+    write_y(T(ym + x));
   }
 }
 
-template <uint8_t Q>
-void write_quad_y(int8_t xm, int8_t ym, int8_t y) {
+template <uint8_t Q, typename T>
+void write_quad_y(T xm, T ym, T y) {
   if (Q == 0) {
-    DAC::Y::write(ym + y);
+    write_y(T(ym + y));
   } else if (Q == 1) {
-    DAC::X::write(xm - y);
+    write_x(T(xm - y));
   } else if (Q == 2) {
-    DAC::Y::write(ym - y);
+    write_y(T(ym - y));
   } else if (Q == 3) {
-    DAC::X::write(xm + y);
+    write_x(T(xm + y));
   }
 }
 
-template <uint8_t Q>
-void draw_quadrant(int8_t xm, int8_t ym, int8_t r) {
+template <uint8_t Q, typename T>
+void draw_quadrant(T xm, T ym, T r) {
   // http://members.chello.at/~easyfilter/bresenham.html
-  int8_t x = -r;
-  int8_t y = 0;
-  int8_t err = 2 - 2*r;
+  T x = -r;
+  T y = 0;
+  T err = 2 - 2*r;
 
   write_quad_x<Q>(xm, ym, x);
   write_quad_y<Q>(xm, ym, y);
@@ -80,19 +235,83 @@ void draw_quadrant(int8_t xm, int8_t ym, int8_t r) {
   }
 }
 
-void draw_circle(int8_t xm, int8_t ym, int8_t r) {
+template <typename T>
+void draw_quadrants(T xm, T ym, T r) {
   draw_quadrant<0>(xm, ym, r);
   draw_quadrant<1>(xm, ym, r);
   draw_quadrant<2>(xm, ym, r);
   draw_quadrant<3>(xm, ym, r);
 }
 
+// Write whole points for circles partly off screen, skipping those off it so
+// the beam jumps the gap rather than tracing along the edge
+template <uint8_t Q>
+void plot_quad(int16_t xm, int16_t ym, int16_t x, int16_t y) {
+  int16_t px, py;
+  if (Q == 0) {
+    px = xm - x, py = ym + y;
+  } else if (Q == 1) {
+    px = xm - y, py = ym - x;
+  } else if (Q == 2) {
+    px = xm + x, py = ym - y;
+  } else {
+    px = xm + y, py = ym + x;
+  }
+  if (px < 0 || px >= DAC::X::RESOLUTION || py < 0 || py >= DAC::Y::RESOLUTION) return;
+  DAC::X::write(px);
+  DAC::Y::write(py);
+}
+
+template <uint8_t Q>
+void draw_quadrant_clipped(int16_t xm, int16_t ym, int16_t r) {
+  // Same steps as draw_quadrant
+  int16_t x = -r;
+  int16_t y = 0;
+  int16_t err = 2 - 2*r;
+
+  plot_quad<Q>(xm, ym, x, y);
+  while (x != 0) {
+    r = err;
+    if (r <= y) {
+      ++y;
+      err += y*2 + 1;
+    }
+    if (r > x || err > y) {
+      ++x;
+      err += x*2 + 1;
+    }
+    plot_quad<Q>(xm, ym, x, y);
+  }
+}
+
+void draw_circle_fast(int8_t xm, int8_t ym, int8_t r) {
+  draw_quadrants<int8_t>(xm, ym, r);
+}
+
+void draw_circle(int8_t xm, int8_t ym, int8_t r) {
+  constexpr int16_t MAX_X = DAC::X::RESOLUTION - 1;
+  constexpr int16_t MAX_Y = DAC::Y::RESOLUTION - 1;
+  if (r < 0) return;
+  // Skip circles whose bounding box is off screen
+  int16_t left = xm - r, right = xm + r;
+  int16_t bottom = ym - r, top = ym + r;
+  if (right < 0 || left > MAX_X || top < 0 || bottom > MAX_Y) return;
+  if (left >= 0 && right <= MAX_X && bottom >= 0 && top <= MAX_Y) {
+    draw_quadrants<int8_t>(xm, ym, r);
+  } else {
+    draw_quadrant_clipped<0>(xm, ym, r);
+    draw_quadrant_clipped<1>(xm, ym, r);
+    draw_quadrant_clipped<2>(xm, ym, r);
+    draw_quadrant_clipped<3>(xm, ym, r);
+  }
+}
+
 void circle_idle() {
   // Cosine in X, sine in Y
   constexpr uint8_t CENTER_X = DAC::X::RESOLUTION / 2;
   constexpr uint8_t CENTER_Y = DAC::Y::RESOLUTION / 2;
   constexpr uint8_t RADIUS = core::util::min(CENTER_X, CENTER_Y) - 1;
-  draw_circle(CENTER_X, CENTER_Y, RADIUS);
+  draw_circle_fast(CENTER_X, CENTER_Y, RADIUS);
 }
 
 void do_circle(Args) {
@@ -103,8 +322,8 @@ void cross_idle() {
   // Triangle wave in X, sawtooth wave in Y
   constexpr uint8_t MAX_X = DAC::X::RESOLUTION - 1;
   constexpr uint8_t MAX_Y = DAC::Y::RESOLUTION - 1;
-  draw_line(0, 0, MAX_X, MAX_Y);
-  draw_line(MAX_X, 0, 0, MAX_Y);
+  draw_line_fast(0, 0, MAX_X, MAX_Y);
+  draw_line_fast(MAX_X, 0, 0, MAX_Y);
 }
 
 void do_cross(Args) {
@@ -125,11 +344,11 @@ void bounce_idle() {
   static uint16_t y = (MIN_Y + RADIUS) * 256;
   static int8_t dx = DX, dy = DY;
   // Draw ball and borders
-  draw_circle(x >> 8, y >> 8, RADIUS);
-  draw_line(MIN_X, MIN_Y, MAX_X, MIN_Y);
-  draw_line(MAX_X, MIN_Y, MAX_X, MAX_Y);
-  draw_line(MAX_X, MAX_Y, MIN_X, MAX_Y);
-  draw_line(MIN_X, MAX_Y, MIN_X, MIN_Y);
+  draw_circle_fast(x >> 8, y >> 8, RADIUS);
+  draw_line_fast(MIN_X, MIN_Y, MAX_X, MIN_Y);
+  draw_line_fast(MAX_X, MIN_Y, MAX_X, MAX_Y);
+  draw_line_fast(MAX_X, MAX_Y, MIN_X, MAX_Y);
+  draw_line_fast(MIN_X, MAX_Y, MIN_X, MIN_Y);
   // Bounce ball off borders
   if (x < (MIN_X + RADIUS) * 256 + DX) dx = DX;
   if (x > (MAX_X - RADIUS) * 256 - DX) dx = -DX;
@@ -144,13 +363,36 @@ IdleFn init_bounce() {
   return bounce_idle;
 }
 
+// Pentagram inscribed in a pentagon, radius 28 about the origin
+static const int8_t STAR_MODEL[] PROGMEM = {
+  6, 0, 28, -16, -23, 27, 9, -27, 9, 16, -23, 0, 28,
+  6, 0, 28, -27, 9, -16, -23, 16, -23, 27, 9, 0, 28,
+  0,
+};
+
+void spin_idle() {
+  constexpr int8_t CENTER_X = DAC::X::RESOLUTION / 2;
+  constexpr int8_t CENTER_Y = DAC::Y::RESOLUTION / 2;
+  static uint8_t angle = 0;
+  // Rotate one step per frame while the scale pulses between 0.5 and 1.0
+  int16_t scale = 192 + (sin8(angle * 3) >> 2);
+  Transform transform;
+  transform.set(angle++, scale, CENTER_X, CENTER_Y);
+  draw_model(transform, STAR_MODEL);
+}
+
+IdleFn init_spin() {
+  return spin_idle;
+}
+
 struct Point { uint8_t x; uint8_t y; };
 
 // Compute random point on circumference
 void random_point(Point& point) {
-  float angle = radians(random(0, 359));
-  point.x = (cos(angle) + 1) * 0.5 * (DAC::X::RESOLUTION - 1);
-  point.y = (sin(angle) + 1) * 0.5 * (DAC::Y::RESOLUTION - 1);
+  uint8_t angle = random(0, 256);
+  // Map [-1, 1] in 8.8 to [0, RESOLUTION - 1]
+  point.x = (uint16_t(cos8(angle) + 256) * (DAC::X::RESOLUTION - 1) + 256) >> 9;
+  point.y = (uint16_t(sin8(angle) + 256) * (DAC::Y::RESOLUTION - 1) + 256) >> 9;
 }
 
 struct Triangle { Point a; Point b; Point c; };
@@ -163,6 +405,20 @@ void random_triangle(Triangle& triangle) {
 }
 
 constexpr uint8_t MAX_TRIS = 8;
+// Dwell per step for each triangle, counting from the oldest, which must
+// survive rounding: queued points are held for whole sample periods and
+// delayMicroseconds(1) returns at once. A queued step already lasts one
+// sample, so a sample more per triangle makes triangle i exactly i + 1 times
+// as bright as the oldest, matching the i + 1 retraces this replaced. A bare
+// step on the ports takes about 1 us, so 2 us more per triangle from a base
+// of 1 us comes close.
+#if defined(DAC_QUEUE)
+constexpr uint8_t CIRCUM_DWELL = DAC_SAMPLE_US;
+constexpr uint8_t CIRCUM_DWELL_BASE = 0;
+#else
+constexpr uint8_t CIRCUM_DWELL = 2;
+constexpr uint8_t CIRCUM_DWELL_BASE = 1;
+#endif
 static uint8_t g_num_tris = 0;
 
 void circum_idle() {
@@ -177,15 +433,14 @@ void circum_idle() {
     }
     random_triangle(buffer[g_num_tris - 1]);
   }
-  // Trace triangles
+  // Trace each triangle once, lingering longer on recently inserted triangles
+  // so they appear brighter
   for (uint8_t i = 0; i < g_num_tris; ++i) {
     Triangle& tri = buffer[i];
-    // Repeat recently inserted triangles so they appear brighter
-    for (uint8_t j = 0; j <= i; ++j) {
-      draw_line(tri.a.x, tri.a.y, tri.b.x, tri.b.y);
-      draw_line(tri.b.x, tri.b.y, tri.c.x, tri.c.y);
-      draw_line(tri.c.x, tri.c.y, tri.a.x, tri.a.y);
-    }
+    uint8_t dwell = CIRCUM_DWELL_BASE + i * CIRCUM_DWELL;
+    draw_line_fast(tri.a.x, tri.a.y, tri.b.x, tri.b.y, dwell);
+    draw_line_fast(tri.b.x, tri.b.y, tri.c.x, tri.c.y, dwell);
+    draw_line_fast(tri.c.x, tri.c.y, tri.a.x, tri.a.y, dwell);
   }
 }
 
@@ -194,41 +449,52 @@ IdleFn init_circum() {
   return circum_idle;
 }
 
-// Compute sine LUT at compile time, stored in Flash memory
 static constexpr uint8_t RESOLUTION = core::util::min(DAC::X::RESOLUTION, DAC::Y::RESOLUTION);
-#define SINE_STEP(i) uint8_t((sin(i * M_PI / 8) + 1.f) * 0.5f * (RESOLUTION - 1))
-static uint8_t const SINE_LUT[16] PROGMEM = {
-  SINE_STEP(0),  SINE_STEP(1),  SINE_STEP(2),  SINE_STEP(3),
-  SINE_STEP(4),  SINE_STEP(5),  SINE_STEP(6),  SINE_STEP(7),
-  SINE_STEP(8),  SINE_STEP(9),  SINE_STEP(10), SINE_STEP(11),
-  SINE_STEP(12), SINE_STEP(13), SINE_STEP(14), SINE_STEP(15),
-};
-#undef SINE_STEP
 
-// Approximate sine with LUT and lerp
-// Could be optimized, but way faster than float
+// Sine scaled to [0, RESOLUTION - 1], with 256 steps per period
 uint8_t uint_sine(uint8_t x) {
-  uint8_t i_a = (x >> 4) & 15;
-  uint8_t i_b = (i_a + 1) & 15;
-  uint8_t a = pgm_read_byte(&SINE_LUT[i_a]);
-  uint8_t b = pgm_read_byte(&SINE_LUT[i_b]);
-  uint8_t t = x & 15;
-  return (a * (16 - t) + b * t) >> 4;
+  return (uint16_t(sin8(x) + 256) * (RESOLUTION - 1) + 256) >> 9;
 }
 
-uint8_t g_lj_ax, g_lj_ay;
+uint8_t g_lj_ax; // Phase of X
 uint8_t g_lj_dx, g_lj_dy;
 uint8_t g_lj_delay;
 
+// For integer frequencies the curve closes after at most 256 steps, so the
+// orbit is cached as tables of X and Y in span memory and replayed each frame.
+// Only X depends on the phase, so only X is regenerated as the phase animates.
+// The orbit is computed on the fly while span memory holds image data.
+constexpr uint16_t ORBIT_STEPS = 256;
+static bool g_orbit_ready = false;
+
+static void fill_orbit_x(uint8_t* orbit) {
+  uint8_t ax = g_lj_ax;
+  for (uint16_t i = 0; i < ORBIT_STEPS; ++i, ax += g_lj_dx) {
+    orbit[i] = uint_sine(ax);
+  }
+}
+
+static void fill_orbit_y(uint8_t* orbit) {
+  uint8_t ay = 0;
+  for (uint16_t i = 0; i < ORBIT_STEPS; ++i, ay += g_lj_dy) {
+    orbit[ORBIT_STEPS + i] = uint_sine(ay);
+  }
+}
+
+// Span memory was taken back, so the cached orbit is gone
+static void release_orbit() {
+  g_orbit_ready = false;
+}
+
 void lissajous_idle() {
-  static uint8_t x0 = 0, y0 = 0;
-  uint8_t x = uint_sine(g_lj_ax);
-  uint8_t y = uint_sine(g_lj_ay);
-  draw_line(x0, y0, x, y);
-  g_lj_ax += g_lj_dx;
-  g_lj_ay += g_lj_dy;
-  x0 = x;
-  y0 = y;
+  uint8_t* orbit = borrow_scratch(release_orbit);
+  if (orbit == nullptr) {
+    g_orbit_ready = false;
+  } else if (!g_orbit_ready) {
+    fill_orbit_x(orbit);
+    fill_orbit_y(orbit);
+    g_orbit_ready = true;
+  }
 
   // Optionally animate the phase difference over time
   if (g_lj_delay) {
@@ -237,6 +503,32 @@ void lissajous_idle() {
     if (now_millis - last_millis > g_lj_delay) {
       last_millis = now_millis;
       g_lj_ax += 1;
+      if (g_orbit_ready) fill_orbit_x(orbit);
+    }
+  }
+
+  if (g_orbit_ready) {
+    // Start from the last point so the first segment closes the loop
+    uint8_t x0 = orbit[ORBIT_STEPS - 1];
+    uint8_t y0 = orbit[ORBIT_STEPS * 2 - 1];
+    for (uint16_t i = 0; i < ORBIT_STEPS; ++i) {
+      uint8_t x = orbit[i];
+      uint8_t y = orbit[ORBIT_STEPS + i];
+      draw_line_fast(x0, y0, x, y);
+      x0 = x;
+      y0 = y;
+    }
+  } else {
+    uint8_t ax = g_lj_ax - g_lj_dx;
+    uint8_t ay = -g_lj_dy;
+    uint8_t x0 = uint_sine(ax);
+    uint8_t y0 = uint_sine(ay);
+    for (uint16_t i = 0; i < ORBIT_STEPS; ++i) {
+      uint8_t x = uint_sine(ax += g_lj_dx);
+      uint8_t y = uint_sine(ay += g_lj_dy);
+      draw_line_fast(x0, y0, x, y);
+      x0 = x;
+      y0 = y;
     }
   }
 }
@@ -245,8 +537,8 @@ void custom_lissajous(Args args) {
   g_lj_dx = args.has_next() ? atoi(args.next()) : 1;
   g_lj_dy = args.has_next() ? atoi(args.next()) : 1;
   g_lj_ax = args.has_next() ? atoi(args.next()) : 64; // Phase, 64 = pi/2
-  g_lj_ay = 0;
   g_lj_delay = args.has_next() ? atoi(args.next()) : 0;
+  g_orbit_ready = false;
   g_idle_fn = lissajous_idle;
 }
 
@@ -254,6 +546,7 @@ IdleFn init_lj_11() {
   g_lj_dx = 1;
   g_lj_dy = 1;
   g_lj_delay = 10;
+  g_orbit_ready = false;
   return lissajous_idle;
 }
 
@@ -261,6 +554,7 @@ IdleFn init_lj_12() {
   g_lj_dx = 1;
   g_lj_dy = 2;
   g_lj_delay = 25;
+  g_orbit_ready = false;
   return lissajous_idle;
 }
 
@@ -268,5 +562,6 @@ IdleFn init_lj_56() {
   g_lj_dx = 5;
   g_lj_dy = 6;
   g_lj_delay = 35;
+  g_orbit_ready = false;
   return lissajous_idle;
 }
@@ -0,0 +1,175 @@
+// Copyright (c) 2022 Trevor Makes
+
+#include "main.hpp"
+
+// Stroke font for text in vector mode, traced as a handful of lines per
+// character rather than scanned pixel by pixel from CHAR_ROM. Glyphs are
+// drawn on a grid 5 units wide with the baseline at 0, capitals reaching up to
+// 6 and descenders down to -1. Each point is a byte:
+//   1 m xxx yyy
+// where m is set to move to the point without drawing and yyy is y + 1. A zero
+// byte (or the end of the slot) ends the glyph. Lowercase letters are drawn as
+// small capitals, using the uppercase glyphs at two thirds of the height.
+// Text is laid out like the bitmap, with rows counting down from the top left
+// corner, and mapped onto the DAC axes with the same flips.
+
+#define M(x, y) (0xC0 | (x) << 3 | ((y) + 1))
+#define L(x, y) (0x80 | (x) << 3 | ((y) + 1))
+
+constexpr uint8_t GLYPH_BYTES = 16;
+constexpr uint8_t GLYPH_ADVANCE = 6; // Grid units from one character to the next
+constexpr uint8_t GLYPH_HEIGHT = 6;
+
+constexpr char FIRST_GLYPH = '!';
+constexpr char LAST_GLYPH = '~';
+
+// Characters from '!' to '~', skipping 'a' to 'z'
+static const uint8_t VFONT[][GLYPH_BYTES] PROGMEM = {
+  { M(2,6), L(2,2), M(2,0), L(2,0) }, // !
+  { M(1,6), L(1,4), M(3,6), L(3,4) }, // "
+  { M(1,0), L(1,6), M(3,0), L(3,6), M(0,2), L(4,2), M(0,4), L(4,4) }, // #
+  { M(4,5), L(1,5), L(0,4), L(1,3), L(3,3), L(4,2), L(3,1), L(0,1), M(2,6), L(2,0) }, // $
+  { M(0,0), L(4,6), M(0,6), L(1,6), L(1,5), L(0,5), L(0,6), M(3,1), L(4,1), L(4,0), L(3,0), L(3,1) }, // %
+  { M(4,0), L(1,4), L(1,5), L(2,6), L(3,5), L(3,4), L(0,2), L(0,1), L(1,0), L(2,0), L(4,2) }, // &
+  { M(2,6), L(2,4) }, // '
+  { M(3,6), L(1,4), L(1,2), L(3,0) }, // (
+  { M(1,6), L(3,4), L(3,2), L(1,0) }, // )
+  { M(2,5), L(2,1), M(0,4), L(4,2), M(0,2), L(4,4) }, // *
+  { M(2,5), L(2,1), M(0,3), L(4,3) }, // +
+  { M(2,1), L(2,0), L(1,-1) }, // ,
+  { M(0,3), L(4,3) }, // -
+  { M(2,0), L(2,0) }, // .
+  { M(0,0), L(4,6) }, // /
+  { M(1,0), L(3,0), L(4,1), L(4,5), L(3,6), L(1,6), L(0,5), L(0,1), L(1,0), M(0,1), L(4,5) }, // 0
+  { M(1,5), L(2,6), L(2,0), M(1,0), L(3,0) }, // 1
+  { M(0,5), L(1,6), L(3,6), L(4,5), L(4,4), L(0,0), L(4,0) }, // 2
+  { M(0,6), L(4,6), L(2,4), L(3,4), L(4,3), L(4,1), L(3,0), L(1,0), L(0,1) }, // 3
+  { M(3,0), L(3,6), L(0,2), L(4,2) }, // 4
+  { M(4,6), L(0,6), L(0,4), L(3,4), L(4,3), L(4,1), L(3,0), L(0,0) }, // 5
+  { M(3,6), L(1,6), L(0,5), L(0,1), L(1,0), L(3,0), L(4,1), L(4,2), L(3,3), L(0,3) }, // 6
+  { M(0,6), L(4,6), L(1,0) }, // 7
+  { M(1,3), L(0,4), L(0,5), L(1,6), L(3,6), L(4,5), L(4,4), L(3,3), L(1,3), L(0,2), L(0,1), L(1,0), L(3,0), L(4,1), L(4,2), L(3,3) }, // 8
+  { M(4,3), L(1,3), L(0,4), L(0,5), L(1,6), L(3,6), L(4,5), L(4,1), L(3,0), L(1,0) }, // 9
+  { M(2,4), L(2,4), M(2,1), L(2,1) }, // :
+  { M(2,4), L(2,4), M(2,1), L(2,0), L(1,-1) }, // ;
+  { M(3,5), L(0,3), L(3,1) }, // <
+  { M(0,4), L(4,4), M(0,2), L(4,2) }, // =
+  { M(1,5), L(4,3), L(1,1) }, // >
+  { M(0,5), L(1,6), L(3,6), L(4,5), L(4,4), L(2,3), L(2,2), M(2,0), L(2,0) }, // ?
+  { M(3,2), L(3,4), L(1,4), L(1,2), L(4,2), L(4,5), L(3,6), L(1,6), L(0,5), L(0,1), L(1,0), L(4,0) }, // @
+  { M(0,0), L(0,4), L(2,6), L(4,4), L(4,0), M(0,3), L(4,3) }, // A
+  { M(0,0), L(0,6), L(3,6), L(4,5), L(4,4), L(3,3), L(0,3), M(3,3), L(4,2), L(4,1), L(3,0), L(0,0) }, // B
+  { M(4,5), L(3,6), L(1,6), L(0,5), L(0,1), L(1,0), L(3,0), L(4,1) }, // C
+  { M(0,0), L(0,6), L(2,6), L(4,4), L(4,2), L(2,0), L(0,0) }, // D
+  { M(4,6), L(0,6), L(0,0), L(4,0), M(0,3), L(3,3) }, // E
+  { M(4,6), L(0,6), L(0,0), M(0,3), L(3,3) }, // F
+  { M(4,5), L(3,6), L(1,6), L(0,5), L(0,1), L(1,0), L(3,0), L(4,1), L(4,3), L(2,3) }, // G
+  { M(0,0), L(0,6), M(4,0), L(4,6), M(0,3), L(4,3) }, // H
+  { M(1,6), L(3,6), M(2,6), L(2,0), M(1,0), L(3,0) }, // I
+  { M(4,6), L(4,1), L(3,0), L(1,0), L(0,1) }, // J
+  { M(0,0), L(0,6), M(4,6), L(0,2), M(1,3), L(4,0) }, // K
+  { M(0,6), L(0,0), L(4,0) }, // L
+  { M(0,0), L(0,6), L(2,3), L(4,6), L(4,0) }, // M
+  { M(0,0), L(0,6), L(4,0), L(4,6) }, // N
+  { M(1,0), L(3,0), L(4,1), L(4,5), L(3,6), L(1,6), L(0,5), L(0,1), L(1,0) }, // O
+  { M(0,0), L(0,6), L(3,6), L(4,5), L(4,4), L(3,3), L(0,3) }, // P
+  { M(1,0), L(3,0), L(4,1), L(4,5), L(3,6), L(1,6), L(0,5), L(0,1), L(1,0), M(2,2), L(4,0) }, // Q
+  { M(0,0), L(0,6), L(3,6), L(4,5), L(4,4), L(3,3), L(0,3), M(2,3), L(4,0) }, // R
+  { M(4,5), L(3,6), L(1,6), L(0,5), L(0,4), L(1,3), L(3,3), L(4,2), L(4,1), L(3,0), L(1,0), L(0,1) }, // S
+  { M(0,6), L(4,6), M(2,6), L(2,0) }, // T
+  { M(0,6), L(0,1), L(1,0), L(3,0), L(4,1), L(4,6) }, // U
+  { M(0,6), L(2,0), L(4,6) }, // V
+  { M(0,6), L(1,0), L(2,3), L(3,0), L(4,6) }, // W
+  { M(0,0), L(4,6), M(0,6), L(4,0) }, // X
+  { M(0,6), L(2,3), L(4,6), M(2,3), L(2,0) }, // Y
+  { M(0,6), L(4,6), L(0,0), L(4,0) }, // Z
+  { M(3,6), L(1,6), L(1,0), L(3,0) }, // [
+  { M(0,6), L(4,0) }, // backslash
+  { M(1,6), L(3,6), L(3,0), L(1,0) }, // ]
+  { M(0,4), L(2,6), L(4,4) }, // ^
+  { M(0,-1), L(4,-1) }, // _
+  { M(1,6), L(2,5) }, // `
+  { M(3,6), L(2,5), L(2,4), L(1,3), L(2,2), L(2,1), L(3,0) }, // {
+  { M(2,6), L(2,-1) }, // |
+  { M(1,6), L(2,5), L(2,4), L(3,3), L(2,2), L(2,1), L(1,0) }, // }
+  { M(0,3), L(1,4), L(3,2), L(4,3) }, // ~
+};
+
+#undef M
+#undef L
+
+static_assert(sizeof(VFONT) / GLYPH_BYTES == LAST_GLYPH - FIRST_GLYPH + 1 - 26,
+  "one glyph per character, less lowercase");
+
+constexpr int8_t MAX_X = DAC::X::RESOLUTION - 1;
+constexpr int8_t MAX_Y = DAC::Y::RESOLUTION - 1;
+
+// Map layout coordinates onto the DAC axes
+static int8_t screen_x(int8_t x) { return g_flip_h ? MAX_X - x : x; }
+static int8_t screen_y(int8_t y) { return g_flip_v ? MAX_Y - y : y; }
+
+// Trace one character with its top left corner at (x, y), with `scale`
+// quarter DAC steps per grid unit
+void draw_vchar(int8_t x, int8_t y, uint8_t scale, char c) {
+  if (c < FIRST_GLYPH || c > LAST_GLYPH) return;
+  uint8_t height = scale;
+  if (c >= 'a' && c <= 'z') {
+    c -= 'a' - 'A';
+    height = scale * 2 / 3;
+  } else if (c > 'z') {
+    c -= 26;
+  }
+
+  // Work in quarter steps from the baseline
+  int16_t left = int16_t(x) * 4;
+  int16_t base = int16_t(y) * 4 + GLYPH_HEIGHT * scale;
+  const uint8_t* glyph = VFONT[c - FIRST_GLYPH];
+  int8_t x0 = 0, y0 = 0;
+  for (uint8_t i = 0; i < GLYPH_BYTES; ++i) {
+    uint8_t point = pgm_read_byte(glyph + i);
+    if (point == 0) break;
+    int8_t x1 = screen_x((left + ((point >> 3) & 7) * scale) >> 2);
+    int8_t y1 = screen_y((base - (int8_t(point & 7) - 1) * height) >> 2);
+    if ((point & 0x40) == 0) draw_line(x0, y0, x1, y1);
+    x0 = x1;
+    y0 = y1;
+  }
+}
+
+void draw_vstring(int8_t x, int8_t y, uint8_t scale, const char* str) {
+  int16_t left = int16_t(x) * 4;
+  for (; *str != '\0'; ++str) {
+    draw_vchar(left >> 2, y, scale, *str);
+    left += GLYPH_ADVANCE * scale;
+  }
+}
+
+void vlogo_idle() {
+  // "Trevor Makes!" between two rules, as in init_logo
+  draw_line_fast(screen_x(0), screen_y(18), screen_x(MAX_X), screen_y(18));
+  draw_vstring(2, 22, 6, "Trevor");
+  draw_vstring(10, 33, 6, "Makes!");
+  draw_line_fast(screen_x(MAX_X), screen_y(45), screen_x(0), screen_y(45));
+}
+
+IdleFn init_vlogo() {
+  return vlogo_idle;
+}
+
+// Lines of text for vprint, scrolled up as each new line is printed
+constexpr uint8_t VTEXT_COLS = 10;
+constexpr uint8_t VTEXT_ROWS = 5;
+constexpr uint8_t VTEXT_PITCH = 12; // DAC steps from one line to the next
+static char g_vtext[VTEXT_ROWS][VTEXT_COLS + 1];
+
+void vtext_idle() {
+  for (uint8_t row = 0; row < VTEXT_ROWS; ++row) {
+    draw_vstring(2, 2 + row * VTEXT_PITCH, 4, g_vtext[row]);
+  }
+}
+
+void vprint_message(Args args) {
+  memmove(g_vtext[0], g_vtext[1], (VTEXT_ROWS - 1) * sizeof(g_vtext[0]));
+  strncpy(g_vtext[VTEXT_ROWS - 1], args.next(), VTEXT_COLS);
+  g_idle_fn = vtext_idle;
+}
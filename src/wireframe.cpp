@@ -0,0 +1,114 @@
+// Copyright (c) 2022 Trevor Makes
+
+#include "main.hpp"
+#include "trig.hpp"
+
+// Rotating 3D wireframes with integer math only. Vertices are stored in
+// quarter DAC steps and must lie within 100 of the origin, which keeps every
+// partial sum of the rotation within int16 and every projected point on
+// screen. Perspective uses a reciprocal table instead of dividing by depth.
+
+struct Model {
+  uint8_t num_verts;
+  uint8_t num_edges;
+  const int8_t* verts; // x, y, z triples in program memory
+  const uint8_t* edges; // Vertex index pairs in program memory
+};
+
+static const int8_t CUBE_VERTS[] PROGMEM = {
+  -56, -56, -56,  56, -56, -56,  56, 56, -56,  -56, 56, -56,
+  -56, -56,  56,  56, -56,  56,  56, 56,  56,  -56, 56,  56,
+};
+
+static const uint8_t CUBE_EDGES[] PROGMEM = {
+  0, 1, 1, 2, 2, 3, 3, 0,
+  4, 5, 5, 6, 6, 7, 7, 4,
+  0, 4, 1, 5, 2, 6, 3, 7,
+};
+
+// Vertices at (0, ±1, ±φ) and cyclic permutations, scaled to radius 96
+static const int8_t ICO_VERTS[] PROGMEM = {
+  0, -50, -82,  -50, -82, 0,  -82, 0, -50,  0, -50, 82,
+  -50, 82, 0,  82, 0, -50,  0, 50, -82,  50, -82, 0,
+  -82, 0, 50,  0, 50, 82,  50, 82, 0,  82, 0, 50,
+};
+
+static const uint8_t ICO_EDGES[] PROGMEM = {
+  0, 1, 0, 2, 0, 5, 0, 6, 0, 7, 1, 2, 1, 3, 1, 7, 1, 8, 2, 4,
+  2, 6, 2, 8, 3, 7, 3, 8, 3, 9, 3, 11, 4, 6, 4, 8, 4, 9, 4, 10,
+  5, 6, 5, 7, 5, 10, 5, 11, 6, 10, 7, 11, 8, 9, 9, 10, 9, 11, 10, 11,
+};
+
+static const Model CUBE = { 8, 12, CUBE_VERTS, CUBE_EDGES };
+static const Model ICO = { 12, 30, ICO_VERTS, ICO_EDGES };
+constexpr uint8_t MAX_VERTS = 12;
+
+// Camera sits 128 DAC steps from the origin. Points at depth d (in DAC steps
+// from the camera) are scaled by 128 / d, looked up as RECIP_LUT[d - RECIP_BASE]
+// in 8.8. Vertices within 100 quarter steps only reach depths 103 to 153.
+constexpr int16_t CAMERA_DISTANCE = 128;
+constexpr uint8_t RECIP_BASE = 96;
+#define RECIP_STEP(i) uint16_t(256. * CAMERA_DISTANCE / (RECIP_BASE + (i)) + 0.5)
+#define RECIP_STEP4(i) RECIP_STEP(i), RECIP_STEP(i + 1), RECIP_STEP(i + 2), RECIP_STEP(i + 3)
+#define RECIP_STEP16(i) RECIP_STEP4(i), RECIP_STEP4(i + 4), RECIP_STEP4(i + 8), RECIP_STEP4(i + 12)
+static const uint16_t RECIP_LUT[64] PROGMEM = {
+  RECIP_STEP16(0), RECIP_STEP16(16), RECIP_STEP16(32), RECIP_STEP16(48),
+};
+#undef RECIP_STEP16
+#undef RECIP_STEP4
+#undef RECIP_STEP
+
+static const Model* g_model = &CUBE;
+
+void wireframe_idle() {
+  constexpr int8_t CENTER_X = DAC::X::RESOLUTION / 2;
+  constexpr int8_t CENTER_Y = DAC::Y::RESOLUTION / 2;
+  static uint8_t yaw = 0, pitch = 0;
+
+  // Rotation about Y by yaw then about X by pitch, in 8.8
+  int16_t cy = cos8(yaw), sy = sin8(yaw);
+  int16_t cp = cos8(pitch), sp = sin8(pitch);
+  const int16_t m[9] = {
+    cy, 0, sy,
+    int16_t((int32_t(sp) * sy) >> 8), cp, int16_t(-(int32_t(sp) * cy) >> 8),
+    int16_t(-(int32_t(cp) * sy) >> 8), sp, int16_t((int32_t(cp) * cy) >> 8),
+  };
+  yaw += 2;
+  pitch += 1;
+
+  // Rotate and project each vertex once
+  const Model& model = *g_model;
+  int8_t screen[MAX_VERTS][2];
+  const int8_t* vert = model.verts;
+  for (uint8_t i = 0; i < model.num_verts; ++i, vert += 3) {
+    int8_t x = pgm_read_byte(vert);
+    int8_t y = pgm_read_byte(vert + 1);
+    int8_t z = pgm_read_byte(vert + 2);
+    int16_t rx = (m[0] * x + m[1] * y + m[2] * z) >> 8;
+    int16_t ry = (m[3] * x + m[4] * y + m[5] * z) >> 8;
+    int16_t rz = (m[6] * x + m[7] * y + m[8] * z) >> 8;
+    // Depth in whole DAC steps picks the reciprocal, which also converts
+    // quarter steps to DAC steps
+    uint8_t depth = CAMERA_DISTANCE + (rz >> 2);
+    uint16_t recip = pgm_read_word(&RECIP_LUT[depth - RECIP_BASE]);
+    screen[i][0] = CENTER_X + ((rx * int16_t(recip)) >> 10);
+    screen[i][1] = CENTER_Y + ((ry * int16_t(recip)) >> 10);
+  }
+
+  const uint8_t* edge = model.edges;
+  for (uint8_t i = 0; i < model.num_edges; ++i, edge += 2) {
+    const int8_t* a = screen[pgm_read_byte(edge)];
+    const int8_t* b = screen[pgm_read_byte(edge + 1)];
+    draw_line_fast(a[0], a[1], b[0], b[1]);
+  }
+}
+
+IdleFn init_cube() {
+  g_model = &CUBE;
+  return wireframe_idle;
+}
+
+IdleFn init_ico() {
+  g_model = &ICO;
+  return wireframe_idle;
+}
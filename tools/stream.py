@@ -0,0 +1,105 @@
+# Stream live vector frames to the board over the binary 'stream' protocol
+# (see src/stream.cpp). Requires pyserial, which comes with PlatformIO.
+#
+# Usage: python3 stream.py [--baud=1000000] [--frames=0] port
+# Draws a spinning star until interrupted, or for the given number of frames.
+# To test without a board, run the native bench with --pty and pass the pty
+# it prints as the port.
+
+import math
+import serial
+import sys
+import time
+
+SYNC = 0xA5
+ACK = 0x06
+NAK = 0x15
+MAX_PAYLOAD = 58
+MAX_VERTS = MAX_PAYLOAD // 2
+RETRIES = 5
+
+# CRC-8 with polynomial x^8 + x^2 + x + 1
+def crc8(data):
+  crc = 0
+  for byte in data:
+    crc ^= byte
+    for _ in range(8):
+      crc = ((crc << 1) ^ 0x07) & 0xFF if crc & 0x80 else (crc << 1) & 0xFF
+  return crc
+
+class XYStream:
+  def __init__(self, port, baud=1000000):
+    # Ask the CLI to switch to streaming, then follow it to the new baud rate
+    self.port = serial.Serial(port, 9600, timeout=1)
+    self.port.write(f'stream {baud}\r'.encode())
+    self.port.flush()
+    time.sleep(0.2)
+    self.port.reset_input_buffer()
+    self.port.baudrate = baud
+    self.packets = 0
+    self.naks = 0
+
+  # Send a packet and wait for the board to accept it, resending on NAK
+  def send(self, type, payload=b''):
+    body = bytes([ord(type), len(payload)]) + bytes(payload)
+    packet = bytes([SYNC]) + body + bytes([crc8(body)])
+    for _ in range(RETRIES):
+      self.port.write(packet)
+      reply = self.port.read(1)
+      if reply == bytes([ACK]):
+        self.packets += 1
+        return
+      self.naks += 1
+    raise IOError('board not responding')
+
+  def points(self, points):
+    for i in range(0, len(points), MAX_VERTS):
+      self.send('P', [c & 0x3F for p in points[i:i + MAX_VERTS] for c in p])
+
+  # Connect the points with lines, overlapping packets by one vertex so the
+  # strip stays joined
+  def strip(self, points):
+    for i in range(0, max(1, len(points) - 1), MAX_VERTS - 1):
+      self.send('L', [c & 0x3F for p in points[i:i + MAX_VERTS] for c in p])
+
+  def frame(self):
+    self.send('F')
+
+  def close(self):
+    self.send('Q')
+    self.port.close()
+
+def star(angle, spikes=5):
+  points = []
+  for i in range(spikes * 2 + 1):
+    r = 30 if i % 2 == 0 else 12
+    a = angle + i * math.pi / spikes
+    points.append((round(32 + r * math.sin(a)), round(32 + r * math.cos(a))))
+  return points
+
+def main(args):
+  flags = [arg for arg in args if arg.startswith('--')]
+  args = [arg for arg in args if not arg.startswith('--')]
+  if len(args) != 1:
+    print(f"Usage: python3 {sys.argv[0]} [--baud=1000000] [--frames=0] port")
+    quit()
+  baud = int(next((f[7:] for f in flags if f.startswith('--baud=')), 1000000))
+  frames = int(next((f[9:] for f in flags if f.startswith('--frames=')), 0))
+
+  stream = XYStream(args[0], baud)
+  start = time.time()
+  count = 0
+  try:
+    while frames == 0 or count < frames:
+      stream.strip(star(count * 0.05))
+      stream.frame()
+      count += 1
+  except KeyboardInterrupt:
+    pass
+  elapsed = time.time() - start
+  stream.close()
+  print(f'{count} frames, {stream.packets} packets, {stream.naks} resent, '
+    f'{count / elapsed:.1f} frames/s')
+
+if __name__ == '__main__':
+  main(sys.argv[1:])